@@ -19,6 +19,7 @@
 #include "cmdlineparser.h"
 
 #include "addoninfo.h"
+#include "analyzerinfo.h"
 #include "check.h"
 #include "checks.h"
 #include "checkers.h"
@@ -391,6 +392,18 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
             return Result::Exit;
         }
 
+        // print the content of an analyzer information file
+        if (std::strncmp(argv[i], "--export-analyzerinfo=", 22) == 0) {
+            std::string xml;
+            const std::string err = AnalyzerInformation::exportXml(argv[i] + 22, xml);
+            if (!err.empty()) {
+                mLogger.printError(err);
+                return Result::Fail;
+            }
+            std::cout << xml;
+            return Result::Exit;
+        }
+
         if (std::strcmp(argv[i], "--filesdir") == 0) {
 #ifdef FILESDIR
             mLogger.printRaw(FILESDIR); // TODO: should not include newline
@@ -605,6 +618,22 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
             }
         }
 
+        // Checking configurations simultaneously
+        else if (std::strncmp(argv[i], "--config-jobs=", 14) == 0) {
+            unsigned int tmp;
+            if (!parseNumberArg(argv[i], 14, tmp))
+                return Result::Fail;
+            if (tmp == 0) {
+                mLogger.printError("argument for '--config-jobs=' must be greater than 0.");
+                return Result::Fail;
+            }
+            if (tmp > 1024) {
+                mLogger.printError("argument for '--config-jobs=' is allowed to be 1024 at max.");
+                return Result::Fail;
+            }
+            mSettings.configJobs = tmp;
+        }
+
         else if (std::strncmp(argv[i], "--cppcheck-build-dir=", 21) == 0) {
             std::string path = Path::fromNativeSeparators(argv[i] + 21);
             if (path.empty()) {
@@ -616,6 +645,18 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
             mSettings.buildDir = std::move(path);
         }
 
+        else if (std::strncmp(argv[i], "--cppcheck-build-dir-format=", 28) == 0) {
+            const std::string format = argv[i] + 28;
+            if (format == "xml")
+                mSettings.buildDirFormat = Settings::BuildDirFormat::XML;
+            else if (format == "binary")
+                mSettings.buildDirFormat = Settings::BuildDirFormat::BINARY;
+            else {
+                mLogger.printError("unknown '--cppcheck-build-dir-format' value '" + format + "'.");
+                return Result::Fail;
+            }
+        }
+
         else if (std::strcmp(argv[i], "--cpp-header-probe") == 0) {
             mSettings.cppHeaderProbe = true;
         }
@@ -821,6 +862,27 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
         else if (std::strcmp(argv[i], "--funsigned-char") == 0)
             defaultSign = 'u';
 
+        // Analyzing the functions of a file simultaneously
+        else if (std::strncmp(argv[i], "--function-jobs=", 16) == 0) {
+            unsigned int tmp;
+            if (!parseNumberArg(argv[i], 16, tmp))
+                return Result::Fail;
+            if (tmp == 0) {
+                mLogger.printError("argument for '--function-jobs=' must be greater than 0.");
+                return Result::Fail;
+            }
+            if (tmp > 1024) {
+                mLogger.printError("argument for '--function-jobs=' is allowed to be 1024 at max.");
+                return Result::Fail;
+            }
+            mSettings.vfOptions.functionJobs = tmp;
+        }
+
+        else if (std::strncmp(argv[i], "--header-cache-size=", 20) == 0) {
+            if (!parseNumberArg(argv[i], 20, mSettings.headerCacheSize))
+                return Result::Fail;
+        }
+
         // Ignored paths
         else if (std::strncmp(argv[i], "-i", 2) == 0) {
             std::string path;
@@ -1171,6 +1233,18 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
             }
         }
 
+        else if (std::strncmp(argv[i], "--process-max-files=", 20) == 0) {
+#ifdef HAS_THREADING_MODEL_FORK
+            unsigned int tmp;
+            if (!parseNumberArg(argv[i], 20, tmp))
+                return Result::Fail;
+            mSettings.processMaxFiles = tmp;
+#else
+            mLogger.printError("Option --process-max-files cannot be used as Cppcheck has not been built with fork threading model.");
+            return Result::Fail;
+#endif
+        }
+
         // --project
         else if (std::strncmp(argv[i], "--project=", 10) == 0) {
             if (projectType != ImportProject::Type::NONE)
@@ -1767,6 +1841,13 @@ void CmdLineParser::printHelp() const
         "                            the hash for a file is unchanged.\n"
         "                          * some useful debug information, i.e. commands used to\n"
         "                            execute clang/clang-tidy/addons.\n"
+        "    --cppcheck-build-dir-format=<format>\n"
+        "                         Format of the analyzer information in the Cppcheck\n"
+        "                         work folder. Existing files are read in either format.\n"
+        "                          * xml (default)\n"
+        "                          * binary: Indexed binary format which is faster to\n"
+        "                            load. Use --export-analyzerinfo to convert a file\n"
+        "                            to XML.\n"
         "    --check-config       Check cppcheck configuration. The normal code\n"
         "                         analysis is disabled by this flag.\n"
         "    --check-level=<level>\n"
@@ -1795,6 +1876,9 @@ void CmdLineParser::printHelp() const
         "                         be considered for evaluation.\n"
         "    --config-excludes-file=<file>\n"
         "                         A file that contains a list of config-excludes\n"
+        "    --config-jobs=<jobs> Start <jobs> threads to check the configurations of a\n"
+        "                         single file simultaneously. The results are reported\n"
+        "                         in the order of the configurations. Default is 1.\n"
         "    --disable=<severity> Disable checks with the given severity.\n"
         "                         Please refer to the documentation of --enable for\n"
         "                         further details.\n"
@@ -1837,6 +1921,9 @@ void CmdLineParser::printHelp() const
         "    --exitcode-suppressions=<file>\n"
         "                         Used when certain messages should be displayed but\n"
         "                         should not cause a non-zero exitcode.\n"
+        "    --export-analyzerinfo=<file>\n"
+        "                         Print the content of an analyzer information file from\n"
+        "                         the Cppcheck work folder in XML format.\n"
         "    --file-filter=<str>  Analyze only those files matching the given filter str.\n"
         "                         Can be used multiple times. When str is '-', the file\n"
         "                         filter will be read from standard input. When str is '+',\n"
@@ -1851,7 +1938,16 @@ void CmdLineParser::printHelp() const
         "                         one that is effective.\n"
         "    --fsigned-char       Treat char type as signed.\n"
         "    --funsigned-char     Treat char type as unsigned.\n"
+        "    --function-jobs=<jobs>\n"
+        "                         Start <jobs> threads to analyze the data flow in the\n"
+        "                         functions of a single file simultaneously. The results\n"
+        "                         are the same as with a single thread. Default is 1.\n"
         "    -h, --help           Print this help.\n"
+        "    --header-cache-size=<MiB>\n"
+        "                         The maximum memory used to cache the tokens of\n"
+        "                         included files. The cache is shared by all the files\n"
+        "                         which are checked so a header is only read and\n"
+        "                         tokenized once. 0 disables the cache. Default is 256.\n"
         "    -I <dir>             Give path to search for include files. Give several -I\n"
         "                         parameters to give several paths. First given path is\n"
         "                         searched for contained header files first. If paths are\n"
@@ -1973,6 +2069,13 @@ void CmdLineParser::printHelp() const
     }
 
     oss <<
+        "    --process-max-files=<n>\n"
+        "                         The number of files a process checks when using the\n"
+        "                         process executor. After that it is replaced by a new\n"
+        "                         process. The processes are reused to avoid the overhead\n"
+        "                         of creating a new process for each file. A process\n"
+        "                         which crashed is always replaced. 0 means no limit.\n"
+        "                         Default is 1.\n"
         "    --project=<file>     Run Cppcheck on project. The <file> can be a Visual\n"
         "                         Studio Solution (*.sln) or (*.slnx), Visual Studio Project\n"
         "                         (*.vcxproj), compile database (compile_commands.json),\n"
@@ -32,6 +32,7 @@
 #include "errorlogger.h"
 #include "errortypes.h"
 #include "filesettings.h"
+#include "headercache.h"
 #include "path.h"
 #include "sarifreport.h"
 #include "settings.h"
@@ -444,7 +445,13 @@ int CppCheckExecutor::check_internal(const Settings& settings, Suppressions& sup
     if (!settings.checkersReportFilename.empty())
         std::remove(settings.checkersReportFilename.c_str());
 
+    // the tokens of the included files are shared by all the files which are checked
+    std::unique_ptr<HeaderCache> headerCache;
+    if (settings.headerCacheSize > 0)
+        headerCache.reset(new HeaderCache(static_cast<std::size_t>(settings.headerCacheSize) * 1024 * 1024));
+
     CppCheck cppcheck(settings, supprs, stdLogger, timerResults.get(), true, executeCommand);
+    cppcheck.setHeaderCache(headerCache.get());
 
     unsigned int returnValue = 0;
     if (settings.useSingleJob()) {
@@ -455,12 +462,14 @@ int CppCheckExecutor::check_internal(const Settings& settings, Suppressions& sup
 #if defined(HAS_THREADING_MODEL_THREAD)
         if (settings.executor == Settings::ExecutorType::Thread) {
             ThreadExecutor executor(mFiles, mFileSettings, settings, supprs, stdLogger, timerResults.get(), CppCheckExecutor::executeCommand);
+            executor.setHeaderCache(headerCache.get());
             returnValue = executor.check();
         }
 #endif
 #if defined(HAS_THREADING_MODEL_FORK)
         if (settings.executor == Settings::ExecutorType::Process) {
             ProcessExecutor executor(mFiles, mFileSettings, settings, supprs, stdLogger, timerResults.get(), CppCheckExecutor::executeCommand);
+            executor.setHeaderCache(headerCache.get());
             returnValue = executor.check();
         }
 #endif
@@ -21,15 +21,16 @@
 #include "color.h"
 #include "errorlogger.h"
 #include "errortypes.h"
+#include "filesettings.h"
+#include "path.h"
 #include "settings.h"
 #include "suppressions.h"
 
+#include <algorithm>
 #include <cassert>
 #include <sstream>
 #include <utility>
 
-struct FileSettings;
-
 Executor::Executor(const std::list<FileWithDetails> &files, const std::list<FileSettings>& fileSettings, const Settings &settings, Suppressions &suppressions, ErrorLogger &errorLogger, TimerResults* timerResults)
     : mFiles(files), mFileSettings(fileSettings), mSettings(settings), mSuppressions(suppressions), mErrorLogger(errorLogger), mTimerResults(timerResults)
 {
@@ -37,6 +38,25 @@ Executor::Executor(const std::list<FileWithDetails> &files, const std::list<File
     assert(!(!files.empty() && !fileSettings.empty()));
 }
 
+std::vector<Executor::Job> Executor::getSchedule() const
+{
+    std::vector<Job> jobs;
+    jobs.reserve(mFiles.size() + mFileSettings.size());
+    for (const FileWithDetails &file : mFiles)
+        jobs.push_back({&file, nullptr, file.size()});
+    for (const FileSettings &fs : mFileSettings) {
+        // the size is not known for files provided by projects
+        const std::size_t cost = fs.file.size() > 0 ? fs.file.size() : Path::fileSize(fs.filename());
+        jobs.push_back({nullptr, &fs, cost});
+    }
+
+    std::stable_sort(jobs.begin(), jobs.end(), [](const Job &a, const Job &b) {
+        return a.cost > b.cost;
+    });
+
+    return jobs;
+}
+
 // TODO: this logic is duplicated in CppCheck::reportErr()
 bool Executor::hasToLog(const ErrorMessage &msg)
 {
@@ -24,6 +24,7 @@
 #include <mutex>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 class Settings;
 class ErrorLogger;
@@ -32,6 +33,7 @@ struct Suppressions;
 struct FileSettings;
 class FileWithDetails;
 class TimerResults;
+class HeaderCache;
 
 /// @addtogroup CLI
 /// @{
@@ -50,6 +52,15 @@ public:
 
     virtual unsigned int check() = 0;
 
+    /**
+     * @brief Use a cache for the raw tokens of included files.
+     * The cache is shared by all the files which are checked.
+     * @param headerCache the cache or nullptr to not use a cache
+     */
+    void setHeaderCache(HeaderCache* headerCache) {
+        mHeaderCache = headerCache;
+    }
+
     /**
      * Information about how many files have been checked
      *
@@ -61,6 +72,23 @@ public:
     void reportStatus(std::size_t fileindex, std::size_t filecount, std::size_t sizedone, std::size_t sizetotal);
 
 protected:
+    /** A single entry to check */
+    struct Job {
+        const FileWithDetails *file;
+        const FileSettings *fs;
+        /** The predicted cost of the analysis */
+        std::size_t cost;
+    };
+
+    /**
+     * @brief Get the order in which the entries should be checked.
+     * The entries are ordered by their predicted cost so the most expensive ones are
+     * started first and do not become the critical path when using multiple jobs.
+     * Entries with the same cost retain their original order.
+     * @return the entries to check
+     */
+    std::vector<Job> getSchedule() const;
+
     /**
      * @brief Check if message is being suppressed and unique.
      * @param msg the message to check
@@ -74,6 +102,7 @@ protected:
     Suppressions &mSuppressions;
     ErrorLogger &mErrorLogger;
     TimerResults *mTimerResults;
+    HeaderCache *mHeaderCache{};
 
 private:
     std::mutex mErrorListSync;
@@ -24,6 +24,7 @@
 
 #ifdef HAS_THREADING_MODEL_FORK
 
+#include "binarystream.h"
 #include "cppcheck.h"
 #include "errorlogger.h"
 #include "errortypes.h"
@@ -52,6 +53,7 @@
 #include <sys/wait.h>
 #include <unistd.h>
 #include <utility>
+#include <vector>
 #include <fcntl.h>
 
 
@@ -85,13 +87,19 @@ namespace {
 
         void reportOut(const std::string &outmsg, Color c) override {
             writeToPipe(REPORT_OUT, static_cast<char>(c) + outmsg);
+            // do not delay the progress output
+            flush();
         }
 
         void reportErr(const ErrorMessage &msg) override {
-            writeToPipe(REPORT_ERROR, msg.serialize());
+            if (mDebug)
+                debugWrite(REPORT_ERROR, msg.serialize());
+            mRecord.clear();
+            msg.serialize(mRecord);
+            writeRecord(REPORT_ERROR, mRecord.data());
         }
 
-        void writeSuppr(const SuppressionList &supprs) const {
+        void writeSuppr(const SuppressionList &supprs) {
             for (const auto& suppr : supprs.getSuppressions())
             {
                 if (suppr.isInline)
@@ -102,23 +110,35 @@ namespace {
         }
 
         void reportMetric(const std::string &metric) override {
-            writeToPipe(REPORT_METRIC, metric);
+            if (mDebug)
+                debugWrite(REPORT_METRIC, metric);
+            mRecord.clear();
+            mRecord.writeString(metric);
+            writeRecord(REPORT_METRIC, mRecord.data());
         }
 
-        void writeTimer(const TimerResults* timerResults) const {
+        void writeTimer(const TimerResults* timerResults) {
             if (!timerResults)
                 return;
 
             for (const auto& entry : timerResults->getResults())
             {
-                for (const auto& d : entry.second) {
-                    writeToPipe(REPORT_TIMER, entry.first + ";" + std::to_string(d.count()));
+                if (mDebug) {
+                    for (const auto& d : entry.second)
+                        debugWrite(REPORT_TIMER, entry.first + ";" + std::to_string(d.count()));
                 }
+                mRecord.clear();
+                mRecord.writeInternedString(entry.first);
+                mRecord.writeUInt(entry.second.size());
+                for (const auto& d : entry.second)
+                    mRecord.writeInt(d.count());
+                writeRecord(REPORT_TIMER, mRecord.data());
             }
         }
 
-        void writeEnd(const std::string& str) const {
+        void writeEnd(const std::string& str) {
             writeToPipe(CHILD_END, str);
+            flush();
         }
 
     private:
@@ -137,56 +157,128 @@ namespace {
         }
 
         // TODO: how to log file name in error?
-        void writeToPipeInternal(PipeSignal type, const void* data, std::size_t to_write) const
+        void flush()
         {
-            const ssize_t bytes_written = write(mWpipe, data, to_write);
-            if (bytes_written <= 0) {
-                const int err = errno;
-                std::cerr << "#### ThreadExecutor::writeToPipeInternal() error for type " << static_cast<unsigned char>(type) << ": " << std::strerror(err) << std::endl;
-                std::exit(EXIT_FAILURE);
-            }
-            // TODO: write until everything is written
-            if (bytes_written != to_write) {
-                std::cerr << "#### ThreadExecutor::writeToPipeInternal() error for type " << static_cast<unsigned char>(type) << ": insufficient data written (expected: " << to_write << " / got: " << bytes_written << ")" << std::endl;
-                std::exit(EXIT_FAILURE);
+            const char *data = mBuffer.data();
+            std::size_t to_write = mBuffer.size();
+            while (to_write > 0) {
+                const ssize_t bytes_written = write(mWpipe, data, to_write);
+                if (bytes_written <= 0) {
+                    const int err = errno;
+                    if (bytes_written < 0 && err == EINTR)
+                        continue;
+                    std::cerr << "#### ThreadExecutor::flush() error: " << std::strerror(err) << std::endl;
+                    std::exit(EXIT_FAILURE);
+                }
+                data += bytes_written;
+                to_write -= bytes_written;
             }
+            mBuffer.clear();
         }
 
-        void writeToPipe(PipeSignal type, const std::string &data) const
+        void debugWrite(PipeSignal type, const std::string &data) const
+        {
+            std::cout << "writeToPipe - " << static_cast<char>(type) << " - " << data << std::endl;
+        }
+
+        void writeToPipe(PipeSignal type, const std::string &data)
         {
             if (mDebug)
-                std::cout << "writeToPipe - " << static_cast<char>(type) << " - " << data << std::endl;
+                debugWrite(type, data);
+            writeRecord(type, data);
+        }
 
-            {
-                const auto t = static_cast<char>(type);
-                writeToPipeInternal(type, &t, 1);
-            }
+        /**
+         * Records are written as the type, the length of the data and the data itself.
+         * They are buffered so a child only performs a few writes for all of its findings.
+         */
+        void writeRecord(PipeSignal type, const std::string &data)
+        {
+            mBuffer += static_cast<char>(type);
 
             const auto len = static_cast<unsigned int>(data.length());
-            {
-                static constexpr std::size_t l_size = sizeof(unsigned int);
-                writeToPipeInternal(type, &len, l_size);
-            }
+            mBuffer.append(reinterpret_cast<const char*>(&len), sizeof(len));
+            mBuffer += data;
 
-            if (len > 0) // TODO: unexpected - write a warning?
-                writeToPipeInternal(type, data.c_str(), len);
+            if (mBuffer.size() >= BufferSize)
+                flush();
         }
 
+        static constexpr std::size_t BufferSize = 64 * 1024;
+
         const int mWpipe;
         const bool mDebug;
+        /** records which have not been written yet */
+        std::string mBuffer;
+        /** the binary data of the current record - keeps the table of the interned strings */
+        BinaryWriter mRecord;
     };
 }
 
-bool ProcessExecutor::handleRead(int rpipe, unsigned int &result, const std::string& filename)
+/** The data received from a child process */
+namespace {
+    /**
+     * Read the index of the next job to check.
+     * @return false if there are no more jobs
+     */
+    bool readJobIndex(int rpipe, std::uint32_t &index)
+    {
+        char *data = reinterpret_cast<char*>(&index);
+        std::size_t to_read = sizeof(index);
+        while (to_read > 0) {
+            const ssize_t bytes_read = read(rpipe, data, to_read);
+            if (bytes_read < 0 && errno == EINTR)
+                continue;
+            if (bytes_read <= 0)
+                return false;
+            data += bytes_read;
+            to_read -= bytes_read;
+        }
+        return true;
+    }
+
+    bool writeJobIndex(int wpipe, std::uint32_t index)
+    {
+        ssize_t bytes_written;
+        do {
+            bytes_written = write(wpipe, &index, sizeof(index));
+        } while (bytes_written < 0 && errno == EINTR);
+        // writes of this size to a pipe are atomic
+        return bytes_written == sizeof(index);
+    }
+}
+
+/** A child process and the data received from it */
+struct ProcessExecutor::PipeData
+{
+    PipeData(pid_t pid, int wpipe, const Job *job) : pid(pid), wpipe(wpipe), job(job) {}
+
+    const pid_t pid;
+    /** the pipe to send the index of the next job to - -1 if the child process only checks a single job */
+    const int wpipe;
+    /** the job which is being checked */
+    const Job *job;
+    /** the number of jobs which have been assigned to the child process */
+    unsigned int jobCount = 1;
+    /** the child process has finished the job */
+    bool jobDone{};
+    /** received data which does not form a complete record yet */
+    std::string buffer;
+    /** keeps the table of the interned strings of the binary records */
+    BinaryReader reader;
+};
+
+bool ProcessExecutor::handleRead(int rpipe, PipeData &pipeData, unsigned int &result, const std::string& filename)
 {
-    std::size_t bytes_to_read;
-    ssize_t bytes_read;
+    static constexpr std::size_t bytes_to_read = 64 * 1024;
 
-    char type = 0;
-    bytes_to_read = sizeof(char);
-    bytes_read = read(rpipe, &type, bytes_to_read);
+    std::string &buffer = pipeData.buffer;
+    const std::size_t buffered = buffer.size();
+    buffer.resize(buffered + bytes_to_read);
+    const ssize_t bytes_read = read(rpipe, &buffer[buffered], bytes_to_read);
     if (bytes_read <= 0) {
-        if (errno == EAGAIN)
+        buffer.resize(buffered);
+        if (bytes_read < 0 && errno == EAGAIN)
             return true;
 
         // TODO: log details about failure
@@ -195,10 +287,29 @@ bool ProcessExecutor::handleRead(int rpipe, unsigned int &result, const std::str
         ++result;
         return false;
     }
-    if (bytes_read != bytes_to_read) {
-        std::cerr << "#### ThreadExecutor::handleRead(" << filename << ") error (type): insufficient data read (expected: " << bytes_to_read << " / got: " << bytes_read << ")" << std::endl;
-        std::exit(EXIT_FAILURE);
+    buffer.resize(buffered + bytes_read);
+
+    // handle all the complete records
+    static constexpr std::size_t header_size = sizeof(char) + sizeof(unsigned int);
+    std::size_t pos = 0;
+    bool res = true;
+    while (res && buffer.size() - pos >= header_size) {
+        const char type = buffer[pos];
+        unsigned int len = 0;
+        std::memcpy(&len, &buffer[pos + sizeof(char)], sizeof(len));
+        if (buffer.size() - pos - header_size < len)
+            break;
+        res = handleRecord(type, buffer.data() + pos + header_size, len, pipeData, result, filename);
+        pos += header_size + len;
     }
+    buffer.erase(0, pos);
+
+    return res;
+}
+
+bool ProcessExecutor::handleRecord(char type, const char *data, std::size_t len, PipeData &pipeData, unsigned int &result, const std::string& filename)
+{
+    BinaryReader &reader = pipeData.reader;
 
     if (type != PipeWriter::REPORT_OUT &&
         type != PipeWriter::REPORT_ERROR &&
@@ -211,102 +322,101 @@ bool ProcessExecutor::handleRead(int rpipe, unsigned int &result, const std::str
         std::exit(EXIT_FAILURE);
     }
 
-    unsigned int len = 0;
-    bytes_to_read = sizeof(len);
-    bytes_read = read(rpipe, &len, bytes_to_read);
-    if (bytes_read <= 0) {
-        const int err = errno;
-        std::cerr << "#### ThreadExecutor::handleRead(" << filename << ") error (len) for type " << int(type) << ": " << std::strerror(err) << std::endl;
-        std::exit(EXIT_FAILURE);
-    }
-    if (bytes_read != bytes_to_read) {
-        std::cerr << "#### ThreadExecutor::handleRead(" << filename << ") error (len) for type" << int(type) << ": insufficient data read (expected: " << bytes_to_read << " / got: " << bytes_read << ")"  << std::endl;
-        std::exit(EXIT_FAILURE);
-    }
-
-    std::string buf(len, '\0');
-    if (len > 0) { // TODO: unexpected - write a warning?
-        char *data_start = &buf[0];
-        bytes_to_read = len;
-        do {
-            bytes_read = read(rpipe, data_start, bytes_to_read);
-            if (bytes_read <= 0) {
-                const int err = errno;
-                std::cerr << "#### ThreadExecutor::handleRead(" << filename << ") error (buf) for type" << int(type) << ": " << std::strerror(err) << std::endl;
-                std::exit(EXIT_FAILURE);
-            }
-            bytes_to_read -= bytes_read;
-            data_start += bytes_read;
-        } while (bytes_to_read != 0);
-    }
-
-    if (mSettings.debugipc)
-        std::cout << "handleRead - " << type << " - " << buf << std::endl;
-
     bool res = true;
-    if (type == PipeWriter::REPORT_OUT) {
-        // the first character is the color
-        const auto c = static_cast<Color>(buf[0]);
-        // TODO: avoid string copy
-        mErrorLogger.reportOut(buf.substr(1), c);
-    } else if (type == PipeWriter::REPORT_ERROR) {
+    if (type == PipeWriter::REPORT_ERROR) {
         ErrorMessage msg;
         try {
-            msg.deserialize(buf);
+            reader.setData(data, len);
+            msg.deserialize(reader);
         } catch (const InternalError& e) {
             std::cerr << "#### ThreadExecutor::handleRead(" << filename << ") internal error: " << e.errorMessage << std::endl;
             std::exit(EXIT_FAILURE);
         }
 
+        if (mSettings.debugipc)
+            std::cout << "handleRead - " << type << " - " << msg.serialize() << std::endl;
+
         if (hasToLog(msg))
             mErrorLogger.reportErr(msg);
-    } else if (type == PipeWriter::REPORT_SUPPR_INLINE || type == PipeWriter::REPORT_SUPPR) {
-        if (!buf.empty()) {
-            // TODO: avoid string splitting
-            auto parts = splitString(buf, ';');
-            if (parts.size() < 5)
-            {
-                // TODO: make this non-fatal
-                std::cerr << "#### ThreadExecutor::handleRead(" << filename << ") adding of inline suppression failed - insufficient data" << std::endl;
-                std::exit(EXIT_FAILURE);
-            }
-            auto suppr = SuppressionList::parseLine(parts[0]);
-            suppr.isInline = (type == PipeWriter::REPORT_SUPPR_INLINE);
-            suppr.column = strToInt<int>(parts[1]);
-            suppr.checked = parts[2] == "1";
-            suppr.matched = parts[3] == "1";
-            suppr.extraComment = parts[4];
-            for (std::size_t i = 5; i < parts.size(); i++) {
-                suppr.extraComment += ";" + parts[i];
-            }
-            const std::string err = mSuppressions.nomsg.addSuppression(suppr);
-            if (!err.empty()) {
-                // TODO: only update state if it doesn't exist - otherwise propagate error
-                mSuppressions.nomsg.updateSuppressionState(suppr); // TODO: check result
-                // TODO: make this non-fatal
-                //std::cerr << "#### ThreadExecutor::handleRead(" << filename << ") adding of inline suppression failed - " << err << std::endl;
-                //std::exit(EXIT_FAILURE);
-            }
-        }
-    } else if (type == PipeWriter::CHILD_END) {
-        result += std::stoi(buf);
-        res = false;
     } else if (type == PipeWriter::REPORT_METRIC) {
-        mErrorLogger.reportMetric(buf);
+        std::string metric;
+        try {
+            reader.setData(data, len);
+            metric = reader.readString();
+        } catch (const InternalError& e) {
+            std::cerr << "#### ThreadExecutor::handleRead(" << filename << ") internal error: " << e.errorMessage << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (mSettings.debugipc)
+            std::cout << "handleRead - " << type << " - " << metric << std::endl;
+
+        mErrorLogger.reportMetric(metric);
     } else if (type == PipeWriter::REPORT_TIMER) {
         if (!mTimerResults) {
             // TODO: make this non-fatal
             std::cerr << "#### ThreadExecutor::handleRead(" << filename << ") received timer results when no timer is enabled" << std::endl;
             std::exit(EXIT_FAILURE);
         }
-        const auto parts = splitString(buf, ';');
-        if (parts.size() < 2)
-        {
+        try {
+            reader.setData(data, len);
+            const std::string name = reader.readInternedString();
+            const std::uint64_t count = reader.readUInt();
+            for (std::uint64_t i = 0; i < count; ++i) {
+                const std::chrono::milliseconds duration{reader.readInt()};
+                if (mSettings.debugipc)
+                    std::cout << "handleRead - " << type << " - " << name << ";" << duration.count() << std::endl;
+                mTimerResults->addResults(name, duration);
+            }
+        } catch (const InternalError& e) {
             // TODO: make this non-fatal
-            std::cerr << "#### ThreadExecutor::handleRead(" << filename << ") adding of timer result failed - insufficient data" << std::endl;
+            std::cerr << "#### ThreadExecutor::handleRead(" << filename << ") adding of timer result failed - " << e.errorMessage << std::endl;
             std::exit(EXIT_FAILURE);
         }
-        mTimerResults->addResults(parts[0], std::chrono::milliseconds{strToInt<long>(parts[1])});
+    } else {
+        const std::string buf(data, len);
+
+        if (mSettings.debugipc)
+            std::cout << "handleRead - " << type << " - " << buf << std::endl;
+
+        if (type == PipeWriter::REPORT_OUT) {
+            // the first character is the color
+            const auto c = static_cast<Color>(buf[0]);
+            // TODO: avoid string copy
+            mErrorLogger.reportOut(buf.substr(1), c);
+        } else if (type == PipeWriter::REPORT_SUPPR_INLINE || type == PipeWriter::REPORT_SUPPR) {
+            if (!buf.empty()) {
+                // TODO: avoid string splitting
+                auto parts = splitString(buf, ';');
+                if (parts.size() < 5)
+                {
+                    // TODO: make this non-fatal
+                    std::cerr << "#### ThreadExecutor::handleRead(" << filename << ") adding of inline suppression failed - insufficient data" << std::endl;
+                    std::exit(EXIT_FAILURE);
+                }
+                auto suppr = SuppressionList::parseLine(parts[0]);
+                suppr.isInline = (type == PipeWriter::REPORT_SUPPR_INLINE);
+                suppr.column = strToInt<int>(parts[1]);
+                suppr.checked = parts[2] == "1";
+                suppr.matched = parts[3] == "1";
+                suppr.extraComment = parts[4];
+                for (std::size_t i = 5; i < parts.size(); i++) {
+                    suppr.extraComment += ";" + parts[i];
+                }
+                const std::string err = mSuppressions.nomsg.addSuppression(suppr);
+                if (!err.empty()) {
+                    // TODO: only update state if it doesn't exist - otherwise propagate error
+                    mSuppressions.nomsg.updateSuppressionState(suppr); // TODO: check result
+                    // TODO: make this non-fatal
+                    //std::cerr << "#### ThreadExecutor::handleRead(" << filename << ") adding of inline suppression failed - " << err << std::endl;
+                    //std::exit(EXIT_FAILURE);
+                }
+            }
+        } else if (type == PipeWriter::CHILD_END) {
+            result += std::stoi(buf);
+            pipeData.jobDone = true;
+            res = false;
+        }
     }
 
     return res;
@@ -349,16 +459,17 @@ unsigned int ProcessExecutor::check()
     supprs.nomsg.addSuppressions(mSuppressions.nomsg.getSuppressions());
     supprs.nofail.addSuppressions(mSuppressions.nofail.getSuppressions());
 
+    const std::vector<Job> jobs = getSchedule();
+
     std::list<int> rpipes;
     std::map<pid_t, std::string> childFile;
-    std::map<int, std::string> pipeFile;
+    std::map<int, PipeData> pipeData;
     std::size_t processedsize = 0;
-    auto iFile = mFiles.cbegin();
-    auto iFileSettings = mFileSettings.cbegin();
+    auto iJob = jobs.cbegin();
     for (;;) {
         // Start a new child
         const size_t nchildren = childFile.size();
-        if ((iFile != mFiles.cend() || iFileSettings != mFileSettings.cend()) && nchildren < mSettings.jobs && checkLoadAverage(nchildren)) {
+        if (iJob != jobs.cend() && nchildren < mSettings.jobs && checkLoadAverage(nchildren)) {
             int pipes[2];
             if (pipe(pipes) == -1) {
                 std::cerr << "#### ThreadExecutor::check, pipe() failed: "<< std::strerror(errno) << std::endl;
@@ -376,6 +487,13 @@ unsigned int ProcessExecutor::check()
                 std::exit(EXIT_FAILURE);
             }
 
+            // the pipe to send further jobs to the child process
+            int jobPipes[2] = {-1, -1};
+            if (mSettings.processMaxFiles != 1 && pipe(jobPipes) == -1) {
+                std::cerr << "#### ThreadExecutor::check, pipe() failed: "<< std::strerror(errno) << std::endl;
+                std::exit(EXIT_FAILURE);
+            }
+
             const pid_t pid = fork();
             if (pid < 0) {
                 // Error
@@ -386,42 +504,68 @@ unsigned int ProcessExecutor::check()
                 prctl(PR_SET_PDEATHSIG, SIGHUP);
 #endif
                 close(pipes[0]);
-
-                // create a separate result object so we do not get the results which have already been transferred back
-                std::unique_ptr<TimerResults> timerResults;
-                if (mTimerResults)
-                    timerResults.reset(new TimerResults);
+                if (jobPipes[1] != -1)
+                    close(jobPipes[1]);
+
+                // do not keep the pipes of the other child processes open - otherwise they will not see the end of their job pipe
+                for (const auto& p : pipeData) {
+                    close(p.first);
+                    if (p.second.wpipe != -1)
+                        close(p.second.wpipe);
+                }
 
                 PipeWriter pipewriter(pipes[1], mSettings.debugipc);
-                CppCheck fileChecker(mSettings, supprs, pipewriter, timerResults.get(), false, mExecuteCommand);
-                unsigned int resultOfCheck = 0;
-
-                if (iFileSettings != mFileSettings.end()) {
-                    resultOfCheck = fileChecker.check(*iFileSettings);
-                } else {
-                    // Read file from a file
-                    resultOfCheck = fileChecker.check(*iFile);
-                }
+                const Job *job = &*iJob;
+                unsigned int jobCount = 0;
+                for (;;) {
+                    // create separate suppressions and result objects so we only transfer back the changes of this job
+                    Suppressions jobSupprs;
+                    jobSupprs.nomsg.addSuppressions(supprs.nomsg.getSuppressions());
+                    jobSupprs.nofail.addSuppressions(supprs.nofail.getSuppressions());
+
+                    std::unique_ptr<TimerResults> timerResults;
+                    if (mTimerResults)
+                        timerResults.reset(new TimerResults);
+
+                    unsigned int resultOfCheck = 0;
+                    {
+                        CppCheck fileChecker(mSettings, jobSupprs, pipewriter, timerResults.get(), false, mExecuteCommand);
+                        // the cache of the child process is only useful if it checks several files
+                        if (mSettings.processMaxFiles != 1)
+                            fileChecker.setHeaderCache(mHeaderCache);
+
+                        if (job->fs) {
+                            resultOfCheck = fileChecker.check(*job->fs);
+                        } else {
+                            // Read file from a file
+                            resultOfCheck = fileChecker.check(*job->file);
+                        }
+                    }
 
-                pipewriter.writeSuppr(supprs.nomsg);
+                    pipewriter.writeSuppr(jobSupprs.nomsg);
 
-                pipewriter.writeTimer(timerResults.get());
+                    pipewriter.writeTimer(timerResults.get());
 
-                pipewriter.writeEnd(std::to_string(resultOfCheck));
+                    pipewriter.writeEnd(std::to_string(resultOfCheck));
+
+                    if (++jobCount == mSettings.processMaxFiles)
+                        break;
+
+                    std::uint32_t index = 0;
+                    if (!readJobIndex(jobPipes[0], index) || index >= jobs.size())
+                        break;
+                    job = &jobs[index];
+                }
                 std::exit(EXIT_SUCCESS);
             }
 
             close(pipes[1]);
+            if (jobPipes[0] != -1)
+                close(jobPipes[0]);
             rpipes.push_back(pipes[0]);
-            if (iFileSettings != mFileSettings.end()) {
-                childFile[pid] = iFileSettings->filename() + ' ' + iFileSettings->cfg;
-                pipeFile[pipes[0]] = iFileSettings->filename() + ' ' + iFileSettings->cfg;
-                ++iFileSettings;
-            } else {
-                childFile[pid] = iFile->path();
-                pipeFile[pipes[0]] = iFile->path();
-                ++iFile;
-            }
+            childFile[pid] = getJobName(*iJob);
+            pipeData.emplace(pipes[0], PipeData(pid, jobPipes[1], &*iJob));
+            ++iJob;
         }
         if (!rpipes.empty()) {
             fd_set rfds;
@@ -437,29 +581,36 @@ unsigned int ProcessExecutor::check()
                 auto rp = rpipes.cbegin();
                 while (rp != rpipes.cend()) {
                     if (FD_ISSET(*rp, &rfds)) {
-                        std::string name;
-                        const auto p = utils::as_const(pipeFile).find(*rp);
-                        if (p != pipeFile.cend()) {
-                            name = p->second;
-                        }
-                        const bool readRes = handleRead(*rp, result, name);
+                        const auto p = pipeData.find(*rp);
+                        assert(p != pipeData.end());
+                        PipeData &data = p->second;
+                        const Job *job = data.job;
+                        const bool readRes = handleRead(*rp, data, result, getJobName(*job));
                         if (!readRes) {
-                            std::size_t size = 0;
-                            if (p != pipeFile.cend()) {
-                                pipeFile.erase(p);
-                                const auto fs = std::find_if(mFiles.cbegin(), mFiles.cend(), [&name](const FileWithDetails& entry) {
-                                    return entry.path() == name;
-                                });
-                                if (fs != mFiles.end()) {
-                                    size = fs->size();
-                                }
-                            }
+                            const std::size_t size = job->file ? job->file->size() : 0;
 
                             fileCount++;
                             processedsize += size;
                             if (!mSettings.quiet)
                                 Executor::reportStatus(fileCount, mFiles.size() + mFileSettings.size(), processedsize, totalfilesize);
 
+                            // pass the next job to the child process if it may check further files
+                            if (data.jobDone && data.wpipe != -1 && iJob != jobs.cend() &&
+                                (mSettings.processMaxFiles == 0 || data.jobCount < mSettings.processMaxFiles) &&
+                                writeJobIndex(data.wpipe, static_cast<std::uint32_t>(iJob - jobs.cbegin()))) {
+                                data.job = &*iJob;
+                                data.jobDone = false;
+                                ++data.jobCount;
+                                childFile[data.pid] = getJobName(*iJob);
+                                ++iJob;
+                                ++rp;
+                                continue;
+                            }
+
+                            // the child process will exit when its job pipe is closed
+                            if (data.wpipe != -1)
+                                close(data.wpipe);
+                            pipeData.erase(p);
                             close(*rp);
                             rp = rpipes.erase(rp);
                         } else
@@ -494,7 +645,7 @@ unsigned int ProcessExecutor::check()
                 }
             }
         }
-        if (iFile == mFiles.end() && iFileSettings == mFileSettings.end() && rpipes.empty() && childFile.empty()) {
+        if (iJob == jobs.cend() && rpipes.empty() && childFile.empty()) {
             // All done
             break;
         }
@@ -505,6 +656,13 @@ unsigned int ProcessExecutor::check()
     return result;
 }
 
+std::string ProcessExecutor::getJobName(const Job &job)
+{
+    if (job.fs)
+        return job.fs->filename() + ' ' + job.fs->cfg;
+    return job.file->path();
+}
+
 void ProcessExecutor::reportInternalChildErr(const std::string &childname, const std::string &msg)
 {
     std::list<ErrorMessage::FileLocation> locations;
@@ -53,11 +53,19 @@ public:
     unsigned int check() override;
 
 private:
+    struct PipeData;
+
     /**
-     * Read from the pipe, parse and handle what ever is in there.
+     * Read from the pipe, parse and handle all the complete records in there.
      * @return False in case of an recoverable error - will exit process on others
      */
-    bool handleRead(int rpipe, unsigned int &result, const std::string& filename);
+    bool handleRead(int rpipe, PipeData &pipeData, unsigned int &result, const std::string& filename);
+
+    /**
+     * Handle a single record received from a child process.
+     * @return False if the child process has finished its job
+     */
+    bool handleRecord(char type, const char *data, std::size_t len, PipeData &pipeData, unsigned int &result, const std::string& filename);
 
     /**
      * @brief Check load average condition
@@ -66,6 +74,11 @@ private:
      */
     bool checkLoadAverage(size_t nchildren);
 
+    /**
+     * @brief Get the name used to identify the entry in messages
+     */
+    static std::string getJobName(const Job &job);
+
     /**
      * @brief Reports internal errors related to child processes
      * @param msg The error message
@@ -27,7 +27,9 @@
 #include "settings.h"
 #include "suppressions.h"
 
+#include <atomic>
 #include <cassert>
+#include <cstddef>
 #include <cstdlib>
 #include <future>
 #include <iostream>
@@ -86,40 +88,28 @@ private:
 class ThreadData
 {
 public:
-    ThreadData(ThreadExecutor &threadExecutor, ErrorLogger &errorLogger, TimerResults *timerResults, const Settings &settings, Suppressions& supprs, const std::list<FileWithDetails> &files, const std::list<FileSettings> &fileSettings, CppCheck::ExecuteCmdFn executeCommand)
-        : mFiles(files), mFileSettings(fileSettings), mTimerResults(timerResults), mSettings(settings), mSuppressions(supprs), mExecuteCommand(std::move(executeCommand)), mLogForwarder(threadExecutor, errorLogger)
+    ThreadData(ThreadExecutor &threadExecutor, ErrorLogger &errorLogger, TimerResults *timerResults, HeaderCache *headerCache, const Settings &settings, Suppressions& supprs, std::vector<ThreadExecutor::Job> jobs, std::size_t totalFileSize, CppCheck::ExecuteCmdFn executeCommand)
+        : mJobs(std::move(jobs)), mTotalFileSize(totalFileSize), mTimerResults(timerResults), mHeaderCache(headerCache), mSettings(settings), mSuppressions(supprs), mExecuteCommand(std::move(executeCommand)), mLogForwarder(threadExecutor, errorLogger)
     {
-        mItNextFile = mFiles.begin();
-        mItNextFileSettings = mFileSettings.begin();
-
-        mTotalFiles = mFiles.size() + mFileSettings.size();
-        mTotalFileSize = std::accumulate(mFiles.cbegin(), mFiles.cend(), std::size_t(0), [](std::size_t v, const FileWithDetails& p) {
-            return v + p.size();
-        });
+        mTotalFiles = mJobs.size();
     }
 
     bool next(const FileWithDetails *&file, const FileSettings *&fs, std::size_t &fileSize) {
-        std::lock_guard<std::mutex> l(mFileSync);
-        if (mItNextFile != mFiles.end()) {
-            file = &(*mItNextFile);
-            fs = nullptr;
-            fileSize = mItNextFile->size();
-            ++mItNextFile;
-            return true;
-        }
-        if (mItNextFileSettings != mFileSettings.end()) {
-            file = nullptr;
-            fs = &(*mItNextFileSettings);
-            fileSize = 0;
-            ++mItNextFileSettings;
-            return true;
-        }
-
-        return false;
+        // idle threads just pull the next most expensive entry
+        const std::size_t i = mNextJob++;
+        if (i >= mJobs.size())
+            return false;
+
+        const ThreadExecutor::Job &job = mJobs[i];
+        file = job.file;
+        fs = job.fs;
+        fileSize = file ? file->size() : 0;
+        return true;
     }
 
     unsigned int check(const FileWithDetails *file, const FileSettings *fs) {
         CppCheck fileChecker(mSettings, mSuppressions, mLogForwarder, mTimerResults, false, mExecuteCommand);
+        fileChecker.setHeaderCache(mHeaderCache);
 
         unsigned int result;
         if (fs) {
@@ -158,18 +148,17 @@ public:
     }
 
 private:
-    const std::list<FileWithDetails> &mFiles;
-    std::list<FileWithDetails>::const_iterator mItNextFile;
-    const std::list<FileSettings> &mFileSettings;
-    std::list<FileSettings>::const_iterator mItNextFileSettings;
+    const std::vector<ThreadExecutor::Job> mJobs;
+    std::atomic<std::size_t> mNextJob{};
 
     std::size_t mProcessedFiles{};
     std::size_t mTotalFiles{};
     std::size_t mProcessedSize{};
-    std::size_t mTotalFileSize{};
+    std::size_t mTotalFileSize;
 
     std::mutex mFileSync;
     TimerResults *mTimerResults;
+    HeaderCache *mHeaderCache;
     const Settings &mSettings;
     Suppressions &mSuppressions;
     CppCheck::ExecuteCmdFn mExecuteCommand;
@@ -199,7 +188,11 @@ unsigned int ThreadExecutor::check()
     std::vector<std::future<unsigned int>> threadFutures;
     threadFutures.reserve(mSettings.jobs);
 
-    ThreadData data(*this, mErrorLogger, mTimerResults, mSettings, mSuppressions, mFiles, mFileSettings, mExecuteCommand);
+    const std::size_t totalFileSize = std::accumulate(mFiles.cbegin(), mFiles.cend(), std::size_t(0), [](std::size_t v, const FileWithDetails& p) {
+        return v + p.size();
+    });
+
+    ThreadData data(*this, mErrorLogger, mTimerResults, mHeaderCache, mSettings, mSuppressions, getSchedule(), totalFileSize, mExecuteCommand);
 
     for (unsigned int i = 0; i < mSettings.jobs; ++i) {
         try {
@@ -499,12 +499,29 @@ namespace simplecpp {
             return mData.cend();
         }
 
+        /** Get the paths which have been looked up but could not be loaded */
+        std::vector<std::string> missing() const {
+            std::vector<std::string> paths;
+            for (const auto &name : mNameMap) {
+                if (name.second == nullptr)
+                    paths.push_back(name.first);
+            }
+            return paths;
+        }
+
         using load_callback_type = std::function<void (FileData &)>;
 
         void set_load_callback(load_callback_type cb) {
             mLoadCallback = std::move(cb);
         }
 
+        /** Function used to read the tokens of a file which is not cached yet */
+        using read_callback_type = std::function<TokenList (const std::string &path, std::vector<std::string> &filenames, OutputList *outputList)>;
+
+        void set_read_callback(read_callback_type cb) {
+            mReadCallback = std::move(cb);
+        }
+
     private:
         struct Impl;
         std::unique_ptr<Impl> mImpl;
@@ -516,6 +533,7 @@ namespace simplecpp {
         container_type mData;
         name_map_type mNameMap;
         load_callback_type mLoadCallback;
+        read_callback_type mReadCallback;
     };
 
     /** Converts character literal (including prefix, but not ud-suffix) to long long value.
@@ -130,6 +130,7 @@ void CheckThread::run()
     mState = Running;
 
     CppCheck cppcheck(mSettings, *mSuppressions, mResult, nullptr, true, executeCommand);
+    cppcheck.setHeaderCache(mHeaderCache.get());
 
     if (!mFiles.empty() || mAnalyseWholeProgram) {
         mAnalyseWholeProgram = false;
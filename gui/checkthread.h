@@ -29,6 +29,7 @@
 #include <list>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <QList>
@@ -39,6 +40,7 @@
 #include <QTime>
 
 class ThreadResult;
+class HeaderCache;
 
 /// @addtogroup GUI
 /// @{
@@ -67,6 +69,15 @@ public:
      */
     void setSettings(const Settings &settings, std::shared_ptr<Suppressions> supprs);
 
+    /**
+     * @brief Set the cache for the tokens of included files
+     *
+     * @param headerCache cache shared by the threads or nullptr
+     */
+    void setHeaderCache(std::shared_ptr<HeaderCache> headerCache) {
+        mHeaderCache = std::move(headerCache);
+    }
+
     /**
      * @brief Run whole program analysis
      * @param files    All files
@@ -138,6 +149,7 @@ protected:
 
     Settings mSettings;
     std::shared_ptr<Suppressions> mSuppressions;
+    std::shared_ptr<HeaderCache> mHeaderCache;
 
 private:
     /**
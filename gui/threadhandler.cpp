@@ -21,11 +21,14 @@
 #include "checkthread.h"
 #include "common.h"
 #include "filesettings.h"
+#include "headercache.h"
 #include "resultsview.h"
 #include "settings.h"
 #include "utils.h"
 
 #include <algorithm>
+#include <cstddef>
+#include <memory>
 #include <string>
 #include <unordered_set>
 #include <utility>
@@ -92,6 +95,7 @@ void ThreadHandler::setupCheckThread(CheckThread &thread) const
     thread.setSuppressions(mSuppressionsUI);
     thread.setClangIncludePaths(mClangIncludePaths);
     thread.setSettings(mCheckSettings, mCheckSuppressions);
+    thread.setHeaderCache(mHeaderCache);
 }
 
 void ThreadHandler::check(const Settings &settings, const std::shared_ptr<Suppressions>& supprs)
@@ -105,6 +109,13 @@ void ThreadHandler::check(const Settings &settings, const std::shared_ptr<Suppre
     mCheckSettings = settings;
     mCheckSuppressions = supprs;
 
+    // the cached files are validated so the cache can be used for the following analyses as well
+    const std::size_t headerCacheSize = static_cast<std::size_t>(mCheckSettings.headerCacheSize) * 1024 * 1024;
+    if (headerCacheSize == 0)
+        mHeaderCache.reset();
+    else if (!mHeaderCache || mHeaderCache->maxSize() != headerCacheSize)
+        mHeaderCache = std::make_shared<HeaderCache>(headerCacheSize);
+
     createThreads(mCheckSettings.jobs);
 
     mRunningThreadCount = mThreads.size();
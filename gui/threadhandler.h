@@ -43,6 +43,7 @@ class QSettings;
 class ImportProject;
 class ErrorItem;
 class FileWithDetails;
+class HeaderCache;
 
 /// @addtogroup GUI
 /// @{
@@ -313,6 +314,11 @@ protected:
     std::shared_ptr<Suppressions> mCheckSuppressions;
     /// @}
 
+    /**
+     * @brief Tokens of the included files - kept between the analyses
+     */
+    std::shared_ptr<HeaderCache> mHeaderCache;
+
     /**
      * @brief Details about currently running threads
      */
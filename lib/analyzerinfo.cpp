@@ -19,19 +19,29 @@
 #include "analyzerinfo.h"
 
 #include "errorlogger.h"
+#include "errortypes.h"
 #include "filesettings.h"
 #include "path.h"
 #include "utils.h"
 
+#include <algorithm>
 #include <array>
 #include <cstring>
+#include <ctime>
 #include <exception>
 #include <iostream>
 #include <map>
 #include <sstream>
 #include <stdexcept>
+#include <sys/stat.h>
 #include <utility>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #include "xml.h"
 
 AnalyzerInformation::~AnalyzerInformation()
@@ -51,6 +61,187 @@ static std::string getFilename(const std::string &fullpath)
     return fullpath.substr(pos1,pos2);
 }
 
+// the binary format starts with this magic number which is followed by the version
+static constexpr char s_binaryMagic[] = "CPPCHKAI";
+static constexpr std::size_t s_binaryMagicSize = sizeof(s_binaryMagic) - 1;
+static constexpr std::uint64_t s_binaryVersion = 1;
+
+namespace {
+    enum SectionKind : std::uint8_t {
+        SECTION_ERRORS = 1,
+        SECTION_FILEINFO = 2,
+        SECTION_DEPENDENCIES = 3
+    };
+
+    /** A section of a binary analyzer information file - the data refers to the memory of the file */
+    struct BinarySection {
+        std::uint64_t kind;
+        std::string name;
+        const char *data;
+        std::size_t size;
+    };
+
+    /** The read-only content of a file which is memory mapped if possible */
+    class MappedFile {
+    public:
+        MappedFile() = default;
+        ~MappedFile() {
+#ifndef _WIN32
+            if (mMapped)
+                munmap(const_cast<char *>(mData), mSize);
+#endif
+        }
+
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        bool open(const std::string &path) {
+#ifdef _WIN32
+            std::ifstream fin(path, std::ios::binary);
+            if (!fin.is_open())
+                return false;
+            std::ostringstream content;
+            content << fin.rdbuf();
+            mBuffer = content.str();
+            mData = mBuffer.data();
+            mSize = mBuffer.size();
+            return true;
+#else
+            const int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd == -1)
+                return false;
+            struct stat file_stat;
+            if (fstat(fd, &file_stat) == -1 || (file_stat.st_mode & S_IFMT) == S_IFDIR) {
+                ::close(fd);
+                return false;
+            }
+            mSize = file_stat.st_size;
+            if (mSize > 0) {
+                void * const data = mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (data == MAP_FAILED) {
+                    ::close(fd);
+                    return false;
+                }
+                mData = static_cast<const char *>(data);
+                mMapped = true;
+            }
+            ::close(fd);
+            return true;
+#endif
+        }
+
+        const char *data() const {
+            return mData;
+        }
+
+        std::size_t size() const {
+            return mSize;
+        }
+
+    private:
+        const char *mData{};
+        std::size_t mSize{};
+#ifdef _WIN32
+        std::string mBuffer;
+#else
+        bool mMapped{};
+#endif
+    };
+
+    /** The content of an analyzer information file in either format */
+    class AnalyzerInfoFile {
+    public:
+        enum class Result : std::uint8_t { Success, NotFound, Failed };
+
+        /**
+         * @param err [out] the reason if the file could not be loaded
+         */
+        Result load(const std::string &path, std::string &err);
+
+        /**
+         * @brief Get the recorded dependencies.
+         * @param dependenciesDoc the document the dependencies of a binary file are parsed into
+         * @return the dependencies element or nullptr if there are no dependencies
+         */
+        const tinyxml2::XMLElement *getDependencies(tinyxml2::XMLDocument &dependenciesDoc) const;
+
+        MappedFile file;
+        bool binary{};
+
+        /** binary format */
+        std::uint64_t hash{};
+        std::vector<BinarySection> sections;
+
+        /** XML format */
+        tinyxml2::XMLDocument doc;
+    };
+}
+
+AnalyzerInfoFile::Result AnalyzerInfoFile::load(const std::string &path, std::string &err)
+{
+    if (!file.open(path))
+        return Result::NotFound;
+
+    binary = file.size() >= s_binaryMagicSize && std::memcmp(file.data(), s_binaryMagic, s_binaryMagicSize) == 0;
+    if (!binary) {
+        const tinyxml2::XMLError xmlError = doc.Parse(file.data(), file.size());
+        if (xmlError != tinyxml2::XML_SUCCESS) {
+            err = tinyxml2::XMLDocument::ErrorIDToName(xmlError);
+            return Result::Failed;
+        }
+        return Result::Success;
+    }
+
+    // only the index is decoded - the sections are decoded when they are needed
+    try {
+        BinaryReader reader;
+        reader.setData(file.data() + s_binaryMagicSize, file.size() - s_binaryMagicSize);
+        if (reader.readUInt() != s_binaryVersion) {
+            err = "unsupported version";
+            return Result::Failed;
+        }
+        hash = reader.readUInt();
+        const std::uint64_t count = reader.readUInt();
+        for (std::uint64_t i = 0; i < count; ++i) {
+            const std::uint64_t kind = reader.readUInt();
+            std::string name = reader.readString();
+            const std::uint64_t size = reader.readUInt();
+            sections.push_back({kind, std::move(name), nullptr, static_cast<std::size_t>(size)});
+        }
+        const char *data = file.data() + file.size() - reader.remaining();
+        const char * const end = file.data() + file.size();
+        for (BinarySection &section : sections) {
+            if (section.size > static_cast<std::size_t>(end - data)) {
+                err = "premature end of data";
+                return Result::Failed;
+            }
+            section.data = data;
+            data += section.size;
+        }
+    } catch (const InternalError &e) {
+        err = e.errorMessage;
+        return Result::Failed;
+    }
+    return Result::Success;
+}
+
+const tinyxml2::XMLElement *AnalyzerInfoFile::getDependencies(tinyxml2::XMLDocument &dependenciesDoc) const
+{
+    if (!binary) {
+        const tinyxml2::XMLElement * const rootNode = doc.FirstChildElement();
+        if (rootNode == nullptr || std::strcmp(rootNode->Name(), "analyzerinfo") != 0)
+            return nullptr;
+        return rootNode->FirstChildElement("dependencies");
+    }
+
+    const auto it = std::find_if(sections.cbegin(), sections.cend(), [](const BinarySection &section) {
+        return section.kind == SECTION_DEPENDENCIES;
+    });
+    if (it == sections.cend() || dependenciesDoc.Parse(it->data, it->size) != tinyxml2::XML_SUCCESS)
+        return nullptr;
+    return dependenciesDoc.FirstChildElement("dependencies");
+}
+
 void AnalyzerInformation::writeFilesTxt(const std::string &buildDir, const std::list<std::string> &sourcefiles, const std::list<FileSettings> &fileSettings)
 {
     const std::string filesTxt(buildDir + "/files.txt");
@@ -83,6 +274,106 @@ void AnalyzerInformation::close()
         mOutputStream << "</analyzerinfo>\n";
         mOutputStream.close();
     }
+    if (!mBinaryFile.empty())
+        writeBinary();
+}
+
+void AnalyzerInformation::writeBinary()
+{
+    if (!mErrors.data().empty())
+        mSections.push_back({SECTION_ERRORS, "", mErrors.data()});
+
+    BinaryWriter index;
+    index.writeUInt(s_binaryVersion);
+    index.writeUInt(mBinaryHash);
+    index.writeUInt(mSections.size());
+    for (const Section &section : mSections) {
+        index.writeUInt(section.kind);
+        index.writeString(section.name);
+        index.writeUInt(section.data.size());
+    }
+
+    std::ofstream fout(mBinaryFile, std::ios::binary | std::ios::trunc);
+    fout.write(s_binaryMagic, s_binaryMagicSize);
+    fout << index.data();
+    for (const Section &section : mSections)
+        fout << section.data;
+
+    mBinaryFile.clear();
+    mSections.clear();
+    mErrors = BinaryWriter();
+}
+
+// TODO: discarding results on internalError doesn't make sense since that won't fix itself
+// Check for invalid license error or internal error, in which case we should retry analysis
+static bool requiresReanalysis(const char *id)
+{
+    static const std::array<const char*, 3> s_ids{
+        "premium-invalidLicense",
+        "premium-internalError",
+        "internalError"
+    };
+    return id && std::any_of(s_ids.cbegin(), s_ids.cend(), [id](const char *retryId) {
+        return std::strcmp(id, retryId) == 0;
+    });
+}
+
+static std::string loadErrors(const tinyxml2::XMLElement *rootNode, std::list<ErrorMessage> &errors)
+{
+    for (const tinyxml2::XMLElement *e = rootNode->FirstChildElement(); e; e = e->NextSiblingElement()) {
+        if (std::strcmp(e->Name(), "error") != 0)
+            continue;
+
+        const char * const id = e->Attribute("id");
+        if (requiresReanalysis(id)) {
+            errors.clear();
+            return std::string("'") + id + "' encountered";
+        }
+
+        errors.emplace_back(e);
+    }
+
+    return "";
+}
+
+static std::string decodeErrors(const std::vector<BinarySection> &sections, std::list<ErrorMessage> &errors)
+{
+    try {
+        for (const BinarySection &section : sections) {
+            if (section.kind != SECTION_ERRORS)
+                continue;
+            // every section has its own string table
+            BinaryReader reader;
+            reader.setData(section.data, section.size);
+            while (!reader.atEnd()) {
+                errors.emplace_back();
+                errors.back().deserialize(reader);
+            }
+        }
+    } catch (const InternalError &e) {
+        errors.clear();
+        return e.errorMessage;
+    }
+    return "";
+}
+
+static std::string loadErrors(const AnalyzerInfoFile &analyzerInfo, std::list<ErrorMessage> &errors)
+{
+    if (!analyzerInfo.binary)
+        return loadErrors(analyzerInfo.doc.FirstChildElement(), errors);
+
+    const std::string err = decodeErrors(analyzerInfo.sections, errors);
+    if (!err.empty())
+        return err;
+    const auto it = std::find_if(errors.cbegin(), errors.cend(), [](const ErrorMessage &msg) {
+        return requiresReanalysis(msg.id.c_str());
+    });
+    if (it != errors.cend()) {
+        const std::string id = it->id;
+        errors.clear();
+        return "'" + id + "' encountered";
+    }
+    return "";
 }
 
 std::string AnalyzerInformation::skipAnalysis(const tinyxml2::XMLDocument &analyzerInfoDoc, std::size_t hash, std::list<ErrorMessage> &errors)
@@ -100,32 +391,185 @@ std::string AnalyzerInformation::skipAnalysis(const tinyxml2::XMLDocument &analy
     if (attr != std::to_string(hash))
         return "hash mismatch";
 
-    for (const tinyxml2::XMLElement *e = rootNode->FirstChildElement(); e; e = e->NextSiblingElement()) {
-        if (std::strcmp(e->Name(), "error") != 0)
-            continue;
+    return loadErrors(rootNode, errors);
+}
 
-        // TODO: discarding results on internalError doesn't make sense since that won't fix itself
-        // Check for invalid license error or internal error, in which case we should retry analysis
-        static const std::array<const char*, 3> s_ids{
-            "premium-invalidLicense",
-            "premium-internalError",
-            "internalError"
-        };
-        for (const auto* id : s_ids)
-        {
-            // cppcheck-suppress useStlAlgorithm
-            if (e->Attribute("id", id)) {
-                errors.clear();
-                return std::string("'") + id + "' encountered";
-            }
+namespace {
+    struct FileTime {
+        bool isDir{};
+        /** modification time in nanoseconds */
+        long long mtime{};
+        long long size{};
+    };
+}
+
+static bool getFileTime(const std::string &path, FileTime &fileTime)
+{
+    struct stat file_stat;
+    if (stat(path.c_str(), &file_stat) == -1)
+        return false;
+    fileTime.isDir = (file_stat.st_mode & S_IFMT) == S_IFDIR;
+#if defined(__APPLE__)
+    fileTime.mtime = static_cast<long long>(file_stat.st_mtimespec.tv_sec) * 1000000000LL + file_stat.st_mtimespec.tv_nsec;
+#elif defined(__linux__)
+    fileTime.mtime = static_cast<long long>(file_stat.st_mtim.tv_sec) * 1000000000LL + file_stat.st_mtim.tv_nsec;
+#else
+    fileTime.mtime = static_cast<long long>(file_stat.st_mtime) * 1000000000LL;
+#endif
+    fileTime.size = file_stat.st_size;
+    return true;
+}
+
+static std::string getAttribute(const tinyxml2::XMLElement *e, const char *name)
+{
+    const char * const attr = e->Attribute(name);
+    return attr ? attr : "";
+}
+
+static bool getContentHash(const std::string &path, std::size_t &hash)
+{
+    std::ifstream fin(path, std::ios::binary);
+    if (!fin.is_open())
+        return false;
+    std::ostringstream content;
+    content << fin.rdbuf();
+    hash = std::hash<std::string>{}(content.str());
+    return true;
+}
+
+std::string AnalyzerInformation::checkDependencies(const tinyxml2::XMLElement *dependencies, bool sourceFile)
+{
+    if (!dependencies)
+        return "no dependencies found";
+
+    bool hasSourceFile = false;
+    for (const tinyxml2::XMLElement *e = dependencies->FirstChildElement(); e; e = e->NextSiblingElement()) {
+        const char * const name = e->Attribute("name");
+        if (!name)
+            return "dependency without name";
+
+        const bool isSourceFile = e->BoolAttribute("source");
+        if (isSourceFile) {
+            if (!sourceFile)
+                continue; // the file has already been compared using the hash
+            hasSourceFile = true;
         }
 
-        errors.emplace_back(e);
+        FileTime fileTime;
+        const bool exists = getFileTime(name, fileTime);
+
+        if (std::strcmp(e->Name(), "missing") == 0) {
+            // the lookup of an included file would find another file now
+            if (exists && !fileTime.isDir)
+                return std::string("'") + name + "' has been created";
+            continue;
+        }
+
+        if (!exists || fileTime.isDir)
+            return std::string("'") + name + "' has been removed";
+        if (std::to_string(fileTime.size) != getAttribute(e, "size"))
+            return std::string("'") + name + "' has been modified";
+        if (std::to_string(fileTime.mtime) == getAttribute(e, "mtime"))
+            continue;
+        // the file might have only been touched
+        std::size_t hash;
+        if (!getContentHash(name, hash) || std::to_string(hash) != getAttribute(e, "hash"))
+            return std::string("'") + name + "' has been modified";
     }
 
+    if (sourceFile && !hasSourceFile)
+        return "file is not a dependency";
+
     return "";
 }
 
+std::string AnalyzerInformation::getDependenciesXml(std::size_t toolInfo, const std::string &sourcefile, const std::set<std::string> &files, const std::set<std::string> &missing)
+{
+    // a modification within the current second might not be visible in the modification time
+    const long long racyTime = static_cast<long long>(std::time(nullptr)) * 1000000000LL;
+
+    std::ostringstream out;
+    out << "  <dependencies toolinfo=\"" << toolInfo << "\">\n";
+
+    const auto writeFile = [&](const std::string &file, bool isSourceFile) {
+        FileTime fileTime;
+        std::size_t hash;
+        if (!getFileTime(file, fileTime) || !getContentHash(file, hash))
+            return false;
+        if (fileTime.mtime >= racyTime)
+            fileTime.mtime = 0; // always compare the content
+        out << "    <file name=\"" << ErrorLogger::toxml(file) << "\" mtime=\"" << fileTime.mtime << "\" size=\"" << fileTime.size << "\" hash=\"" << hash << '"';
+        if (isSourceFile)
+            out << " source=\"true\"";
+        out << "/>\n";
+        return true;
+    };
+
+    if (!sourcefile.empty() && !writeFile(sourcefile, true))
+        return "";
+    for (const std::string &file : files) {
+        if (!writeFile(file, false))
+            return "";
+    }
+    for (const std::string &path : missing)
+        out << "    <missing name=\"" << ErrorLogger::toxml(path) << "\"/>\n";
+
+    out << "  </dependencies>\n";
+    return out.str();
+}
+
+void AnalyzerInformation::setDependencies(std::size_t toolInfo, const std::string &sourcefile, const std::set<std::string> &files, const std::set<std::string> &missing)
+{
+    if (mOutputStream.is_open())
+        mOutputStream << getDependenciesXml(toolInfo, sourcefile, files, missing);
+    else if (!mBinaryFile.empty()) {
+        std::string xml = getDependenciesXml(toolInfo, sourcefile, files, missing);
+        if (!xml.empty())
+            mSections.push_back({SECTION_DEPENDENCIES, "", std::move(xml)});
+    }
+}
+
+bool AnalyzerInformation::skipAnalysisByDependencies(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg, std::size_t fsFileId, std::size_t toolInfo, std::list<ErrorMessage> &errors, bool debug)
+{
+    if (buildDir.empty() || sourcefile.empty())
+        return false;
+
+    const std::string analyzerInfoFile = AnalyzerInformation::getAnalyzerInfoFile(buildDir,sourcefile,cfg,fsFileId);
+
+    AnalyzerInfoFile analyzerInfo;
+    std::string err;
+    if (analyzerInfo.load(analyzerInfoFile, err) != AnalyzerInfoFile::Result::Success)
+        return false;
+
+    // the results are validated by analyzeFile() when the file was not recorded
+    tinyxml2::XMLDocument dependenciesDoc;
+    const tinyxml2::XMLElement * const dependencies = analyzerInfo.getDependencies(dependenciesDoc);
+    if (!dependencies)
+        return false;
+    const tinyxml2::XMLElement *e = dependencies->FirstChildElement("file");
+    while (e && !e->BoolAttribute("source"))
+        e = e->NextSiblingElement("file");
+    if (!e)
+        return false;
+
+    if (std::to_string(toolInfo) != getAttribute(dependencies, "toolinfo"))
+        err = "options changed";
+    else
+        err = checkDependencies(dependencies, true);
+    if (err.empty())
+        err = loadErrors(analyzerInfo, errors);
+
+    if (!err.empty()) {
+        if (debug)
+            std::cout << "cannot skip reading '" << sourcefile << "' using the dependencies from '" << analyzerInfoFile << "' - " << err << std::endl;
+        return false;
+    }
+
+    if (debug)
+        std::cout << "skipping analysis - loaded " << errors.size() << " cached finding(s) from '" << analyzerInfoFile << "' for '" << sourcefile <<  "' (dependencies unchanged)" << std::endl;
+    return true;
+}
+
 std::string AnalyzerInformation::getAnalyzerInfoFileFromFilesTxt(std::istream& filesTxt, const std::string &sourcefile, const std::string &cfg, size_t fsFileId)
 {
     std::string line;
@@ -160,7 +604,7 @@ std::string AnalyzerInformation::getAnalyzerInfoFile(const std::string &buildDir
 
 bool AnalyzerInformation::analyzeFile(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg, std::size_t fsFileId, std::size_t hash, std::list<ErrorMessage> &errors, bool debug)
 {
-    if (mOutputStream.is_open())
+    if (mOutputStream.is_open() || !mBinaryFile.empty())
         throw std::runtime_error("analyzer information file is already open");
 
     if (buildDir.empty() || sourcefile.empty())
@@ -169,10 +613,21 @@ bool AnalyzerInformation::analyzeFile(const std::string &buildDir, const std::st
     const std::string analyzerInfoFile = AnalyzerInformation::getAnalyzerInfoFile(buildDir,sourcefile,cfg,fsFileId);
 
     {
-        tinyxml2::XMLDocument analyzerInfoDoc;
-        const tinyxml2::XMLError xmlError = analyzerInfoDoc.LoadFile(analyzerInfoFile.c_str());
-        if (xmlError == tinyxml2::XML_SUCCESS) {
-            const std::string err = skipAnalysis(analyzerInfoDoc, hash, errors);
+        AnalyzerInfoFile analyzerInfo;
+        std::string err;
+        const AnalyzerInfoFile::Result result = analyzerInfo.load(analyzerInfoFile, err);
+        if (result == AnalyzerInfoFile::Result::Success) {
+            if (analyzerInfo.binary)
+                err = analyzerInfo.hash == hash ? loadErrors(analyzerInfo, errors) : "hash mismatch";
+            else
+                err = skipAnalysis(analyzerInfo.doc, hash, errors);
+            if (err.empty()) {
+                // the included files are not part of the hash
+                tinyxml2::XMLDocument dependenciesDoc;
+                err = checkDependencies(analyzerInfo.getDependencies(dependenciesDoc), false);
+                if (!err.empty())
+                    errors.clear();
+            }
             if (err.empty()) {
                 if (debug)
                     std::cout << "skipping analysis - loaded " << errors.size() << " cached finding(s) from '" << analyzerInfoFile << "' for '" << sourcefile <<  "'" << std::endl;
@@ -182,14 +637,24 @@ bool AnalyzerInformation::analyzeFile(const std::string &buildDir, const std::st
                 std::cout << "discarding cached result from '" << analyzerInfoFile << "' for '" << sourcefile << "' - " << err << std::endl;
             }
         }
-        else if (xmlError != tinyxml2::XML_ERROR_FILE_NOT_FOUND) {
+        else if (result == AnalyzerInfoFile::Result::Failed) {
             if (debug)
-                std::cout << "discarding cached result - failed to load '" << analyzerInfoFile << "' for '" << sourcefile << "' (" << tinyxml2::XMLDocument::ErrorIDToName(xmlError) << ")" << std::endl;
+                std::cout << "discarding cached result - failed to load '" << analyzerInfoFile << "' for '" << sourcefile << "' (" << err << ")" << std::endl;
         }
         else if (debug)
             std::cout << "no cached result '" << analyzerInfoFile << "' for '" << sourcefile << "' found" << std::endl;
     }
 
+    if (mBinary) {
+        // the file is written when it is closed
+        std::ofstream fout(analyzerInfoFile, std::ios::binary | std::ios::trunc);
+        if (!fout.is_open())
+            throw std::runtime_error("failed to open '" + analyzerInfoFile + "'");
+        mBinaryFile = analyzerInfoFile;
+        mBinaryHash = hash;
+        return true;
+    }
+
     mOutputStream.open(analyzerInfoFile);
     if (!mOutputStream.is_open())
         throw std::runtime_error("failed to open '" + analyzerInfoFile + "'");
@@ -203,12 +668,18 @@ void AnalyzerInformation::reportErr(const ErrorMessage &msg)
 {
     if (mOutputStream.is_open())
         mOutputStream << msg.toXML() << '\n';
+    else if (!mBinaryFile.empty())
+        msg.serialize(mErrors);
 }
 
 void AnalyzerInformation::setFileInfo(const std::string &check, const std::string &fileInfo)
 {
-    if (mOutputStream.is_open() && !fileInfo.empty())
+    if (fileInfo.empty())
+        return;
+    if (mOutputStream.is_open())
         mOutputStream << "  <FileInfo check=\"" << check << "\">\n" << fileInfo << "  </FileInfo>\n";
+    else if (!mBinaryFile.empty())
+        mSections.push_back({SECTION_FILEINFO, check, "  <FileInfo check=\"" + check + "\">\n" + fileInfo + "  </FileInfo>\n"});
 }
 
 // TODO: report detailed errors?
@@ -239,7 +710,7 @@ bool AnalyzerInformation::Info::parse(const std::string& filesTxtLine) {
     return true;
 }
 
-std::string AnalyzerInformation::processFilesTxt(const std::string& buildDir, const std::function<void(const char* checkattr, const tinyxml2::XMLElement* e, const Info& filesTxtInfo)>& handler, bool debug)
+std::string AnalyzerInformation::processFilesTxt(const std::string& buildDir, const std::function<void(const char* checkattr, const tinyxml2::XMLElement* e, const Info& filesTxtInfo)>& handler, bool debug, const std::function<bool(const char* checkattr)>& filter)
 {
     const std::string filesTxt(buildDir + "/files.txt");
     std::ifstream fin(filesTxt.c_str());
@@ -252,30 +723,47 @@ std::string AnalyzerInformation::processFilesTxt(const std::string& buildDir, co
         if (filesTxtInfo.afile.empty())
             return "empty afile from '" + filesTxt + "'";
 
-        const std::string xmlfile = buildDir + '/' + filesTxtInfo.afile;
+        const std::string analyzerInfoFile = buildDir + '/' + filesTxtInfo.afile;
 
-        tinyxml2::XMLDocument doc;
-        const tinyxml2::XMLError error = doc.LoadFile(xmlfile.c_str());
-        if (error == tinyxml2::XML_ERROR_FILE_NOT_FOUND) {
+        AnalyzerInfoFile analyzerInfo;
+        std::string err;
+        const AnalyzerInfoFile::Result result = analyzerInfo.load(analyzerInfoFile, err);
+        if (result == AnalyzerInfoFile::Result::NotFound) {
             /* FIXME: this can currently not be reported as an error because:
              * - --clang does not generate any analyzer information - see #14456
              * - markup files might not generate analyzer information
              * - files with preprocessor errors might not generate analyzer information
              */
             if (debug)
-                std::cout << "'" + xmlfile + "' from '" + filesTxt + "' not found";
+                std::cout << "'" + analyzerInfoFile + "' from '" + filesTxt + "' not found";
             continue;
         }
 
-        if (error != tinyxml2::XML_SUCCESS)
-            return "failed to load '" + xmlfile + "' from '" + filesTxt + "'";
+        if (result != AnalyzerInfoFile::Result::Success)
+            return "failed to load '" + analyzerInfoFile + "' from '" + filesTxt + "'";
+
+        if (analyzerInfo.binary) {
+            // only the data which is requested is parsed
+            for (const BinarySection &section : analyzerInfo.sections) {
+                if (section.kind != SECTION_FILEINFO || (filter && !filter(section.name.c_str())))
+                    continue;
+                tinyxml2::XMLDocument doc;
+                const tinyxml2::XMLElement *e = nullptr;
+                if (doc.Parse(section.data, section.size) == tinyxml2::XML_SUCCESS)
+                    e = doc.FirstChildElement("FileInfo");
+                if (!e)
+                    return "failed to load '" + section.name + "' data of '" + analyzerInfoFile + "' from '" + filesTxt + "'";
+                handler(section.name.c_str(), e, filesTxtInfo);
+            }
+            continue;
+        }
 
-        const tinyxml2::XMLElement * const rootNode = doc.FirstChildElement();
+        const tinyxml2::XMLElement * const rootNode = analyzerInfo.doc.FirstChildElement();
         if (rootNode == nullptr)
-            return "no root node found in '" + xmlfile + "' from '" + filesTxt + "'";
+            return "no root node found in '" + analyzerInfoFile + "' from '" + filesTxt + "'";
 
         if (strcmp(rootNode->Name(), "analyzerinfo") != 0)
-            return "unexpected root node in '" + xmlfile + "' from '" + filesTxt + "'";
+            return "unexpected root node in '" + analyzerInfoFile + "' from '" + filesTxt + "'";
 
         for (const tinyxml2::XMLElement *e = rootNode->FirstChildElement(); e; e = e->NextSiblingElement()) {
             if (std::strcmp(e->Name(), "FileInfo") != 0)
@@ -283,9 +771,11 @@ std::string AnalyzerInformation::processFilesTxt(const std::string& buildDir, co
             const char *checkattr = e->Attribute("check");
             if (checkattr == nullptr) {
                 if (debug)
-                    std::cout << "'check' attribute missing in 'FileInfo' in '" << xmlfile << "' from '" << filesTxt + "'";
+                    std::cout << "'check' attribute missing in 'FileInfo' in '" << analyzerInfoFile << "' from '" << filesTxt + "'";
                 continue;
             }
+            if (filter && !filter(checkattr))
+                continue;
             handler(checkattr, e, filesTxtInfo);
         }
     }
@@ -294,12 +784,60 @@ std::string AnalyzerInformation::processFilesTxt(const std::string& buildDir, co
     return "";
 }
 
+std::string AnalyzerInformation::exportXml(const std::string &analyzerInfoFile, std::string &xml)
+{
+    AnalyzerInfoFile analyzerInfo;
+    std::string err;
+    const AnalyzerInfoFile::Result result = analyzerInfo.load(analyzerInfoFile, err);
+    if (result == AnalyzerInfoFile::Result::NotFound)
+        return "'" + analyzerInfoFile + "' not found";
+    if (result != AnalyzerInfoFile::Result::Success)
+        return "failed to load '" + analyzerInfoFile + "' (" + err + ")";
+
+    if (!analyzerInfo.binary) {
+        xml.assign(analyzerInfo.file.data(), analyzerInfo.file.size());
+        return "";
+    }
+
+    std::list<ErrorMessage> errors;
+    err = decodeErrors(analyzerInfo.sections, errors);
+    if (!err.empty())
+        return "failed to load '" + analyzerInfoFile + "' (" + err + ")";
+
+    std::ostringstream out;
+    out << "<?xml version=\"1.0\"?>\n";
+    out << "<analyzerinfo hash=\"" << analyzerInfo.hash << "\">\n";
+    for (const ErrorMessage &msg : errors)
+        out << msg.toXML() << '\n';
+    for (const BinarySection &section : analyzerInfo.sections) {
+        if (section.kind != SECTION_ERRORS)
+            out.write(section.data, section.size);
+    }
+    out << "</analyzerinfo>\n";
+    xml = out.str();
+    return "";
+}
+
 void AnalyzerInformation::reopen(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg, std::size_t fsFileId)
 {
     if (buildDir.empty() || sourcefile.empty())
         return;
 
     const std::string analyzerInfoFile = AnalyzerInformation::getAnalyzerInfoFile(buildDir,sourcefile,cfg,fsFileId);
+
+    {
+        AnalyzerInfoFile analyzerInfo;
+        std::string err;
+        if (analyzerInfo.load(analyzerInfoFile, err) == AnalyzerInfoFile::Result::Success && analyzerInfo.binary) {
+            // the new findings are written to an additional section
+            mBinaryFile = analyzerInfoFile;
+            mBinaryHash = analyzerInfo.hash;
+            for (const BinarySection &section : analyzerInfo.sections)
+                mSections.push_back({static_cast<std::uint8_t>(section.kind), section.name, std::string(section.data, section.size)});
+            return;
+        }
+    }
+
     std::ifstream ifs(analyzerInfoFile);
     if (!ifs.is_open())
         return;
@@ -21,13 +21,17 @@
 #define analyzerinfoH
 //---------------------------------------------------------------------------
 
+#include "binarystream.h"
 #include "config.h"
 
 #include <cstddef>
+#include <cstdint>
 #include <fstream>
 #include <functional>
 #include <list>
+#include <set>
 #include <string>
+#include <vector>
 
 class ErrorMessage;
 struct FileSettings;
@@ -47,14 +51,24 @@ namespace tinyxml2 {
  * - checksum
  * - error messages
  * - whole program analysis data
+ * - dependencies (included files and the include lookups which failed)
  *
  * The information can be used for various purposes. It allows:
  * - 'make' - only analyze TUs that are changed and generate full report
  * - should be possible to add distributed analysis later
  * - multi-threaded whole program analysis
+ *
+ * The information is either stored as XML or in a binary format with an index
+ * of its sections. The binary files are memory mapped when they are read and
+ * only the requested sections are decoded. The format of existing files is
+ * detected when they are read.
  */
 class CPPCHECKLIB AnalyzerInformation {
 public:
+    /**
+     * @param binary write the information in the binary format
+     */
+    explicit AnalyzerInformation(bool binary = false) : mBinary(binary) {}
     ~AnalyzerInformation();
 
     static void writeFilesTxt(const std::string &buildDir, const std::list<std::string> &sourcefiles, const std::list<FileSettings> &fileSettings);
@@ -65,6 +79,25 @@ public:
      * @throws std::runtime_error thrown if the output file is already open or the output file cannot be opened
      */
     bool analyzeFile(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg, std::size_t fsFileId, std::size_t hash, std::list<ErrorMessage> &errors, bool debug = false);
+
+    /**
+     * @brief Check if the results of the previous analysis can be used without reading the file.
+     * This is only possible if the file itself was recorded as a dependency and none of the
+     * dependencies have changed.
+     * @param toolInfo hash of the options which affect the analysis
+     * @return true if the results can be used - they are added to @p errors
+     */
+    static bool skipAnalysisByDependencies(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg, std::size_t fsFileId, std::size_t toolInfo, std::list<ErrorMessage> &errors, bool debug = false);
+
+    /**
+     * @brief Record what the analysis depends on.
+     * @param toolInfo hash of the options which affect the analysis
+     * @param sourcefile the analyzed file - empty if the file needs to be read when the results are reused
+     * @param files the included files
+     * @param missing the paths which were looked up but do not exist
+     */
+    void setDependencies(std::size_t toolInfo, const std::string &sourcefile, const std::set<std::string> &files, const std::set<std::string> &missing);
+
     void reportErr(const ErrorMessage &msg);
     void setFileInfo(const std::string &check, const std::string &fileInfo);
     static std::string getAnalyzerInfoFile(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg, std::size_t fsFileId);
@@ -82,7 +115,20 @@ public:
         std::string sourceFile;
     };
 
-    static std::string processFilesTxt(const std::string& buildDir, const std::function<void(const char* checkattr, const tinyxml2::XMLElement* e, const Info& filesTxtInfo)>& handler, bool debug = false);
+    /**
+     * @brief Pass the whole program analysis data of all files in files.txt to a handler.
+     * @param filter only load the data of the checks which are accepted - all data is loaded if not set
+     * @return empty string on success - otherwise the error
+     */
+    static std::string processFilesTxt(const std::string& buildDir, const std::function<void(const char* checkattr, const tinyxml2::XMLElement* e, const Info& filesTxtInfo)>& handler, bool debug = false, const std::function<bool(const char* checkattr)>& filter = {});
+
+    /**
+     * @brief Get the content of an analyzer information file as XML.
+     * @param analyzerInfoFile the file in either format
+     * @param xml [out] the XML
+     * @return empty string on success - otherwise the error
+     */
+    static std::string exportXml(const std::string &analyzerInfoFile, std::string &xml);
 
 protected:
     static std::string getFilesTxt(const std::list<std::string> &sourcefiles, const std::list<FileSettings> &fileSettings);
@@ -91,8 +137,36 @@ protected:
 
     static std::string skipAnalysis(const tinyxml2::XMLDocument &analyzerInfoDoc, std::size_t hash, std::list<ErrorMessage> &errors);
 
+    /**
+     * @brief Check if the recorded dependencies have changed.
+     * @param dependencies the dependencies element - nullptr if there are no dependencies
+     * @param sourceFile also require the analyzed file to be recorded
+     * @return empty string if nothing changed - otherwise the reason
+     */
+    static std::string checkDependencies(const tinyxml2::XMLElement *dependencies, bool sourceFile);
+
+    static std::string getDependenciesXml(std::size_t toolInfo, const std::string &sourcefile, const std::set<std::string> &files, const std::set<std::string> &missing);
+
 private:
+    /** Write the information in the binary format */
+    void writeBinary();
+
     std::ofstream mOutputStream;
+
+    bool mBinary;
+
+    /** A section of a binary analyzer information file */
+    struct Section {
+        std::uint8_t kind;
+        std::string name;
+        std::string data;
+    };
+
+    /** the binary file which is written when closed */
+    std::string mBinaryFile;
+    std::size_t mBinaryHash{};
+    std::vector<Section> mSections;
+    BinaryWriter mErrors;
 };
 
 /// @}
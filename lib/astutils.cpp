@@ -346,8 +346,8 @@ std::string astCanonicalType(const Token *expr, bool pointedToType)
     std::pair<const Token*, const Token*> decl = Token::typeDecl(expr, pointedToType);
     if (decl.first && decl.second) {
         std::string ret;
-        for (const Token *type = decl.first; Token::Match(type,"%name%|::") && type != decl.second; type = type->next()) {
-            if (!Token::Match(type, "const|static"))
+        for (const Token *type = decl.first; Token::Match(type,MATCH_PATTERN("%name%|::")) && type != decl.second; type = type->next()) {
+            if (!Token::Match(type, MATCH_PATTERN("const|static")))
                 ret += type->str();
         }
         return ret;
@@ -1131,7 +1131,7 @@ bool exprDependsOnThis(const Token* expr, bool onVar, nonneg int depth)
     ++depth;
 
     // calling nonstatic method?
-    if (Token::Match(expr, "%name% (")) {
+    if (Token::Match(expr, MATCH_PATTERN("%name% ("))) {
         if (expr->function() && expr->function()->nestedIn && expr->function()->nestedIn->isClassOrStruct() && !expr->function()->isStatic()) {
             // is it a method of this?
             const Scope* fScope = expr->scope();
@@ -1610,7 +1610,7 @@ bool isSameExpression(bool macro, const Token *tok1, const Token *tok2, const Se
     if (Token::simpleMatch(tok2, "!") && Token::simpleMatch(tok2->astOperand1(), "!") && !Token::simpleMatch(tok2->astParent(), "=") && astIsBoolLike(tok1, settings)) {
         return isSameExpression(macro, tok1, tok2->astOperand1()->astOperand1(), settings, pure, followVar, errors);
     }
-    const bool tok_str_eq = tok1->str() == tok2->str();
+    const bool tok_str_eq = Token::sameStr(tok1, tok2);
     if (!tok_str_eq && isDifferentKnownValues(tok1, tok2))
         return false;
 
@@ -2355,11 +2355,11 @@ static T* getTokenArgumentFunctionImpl(T* tok, int& argn)
             parent = parent->astParent();
         while (parent && parent->isCast())
             parent = parent->astParent();
-        if (Token::Match(parent, "[+-]") && parent->valueType() && parent->valueType()->pointer)
+        if (Token::Match(parent, MATCH_PATTERN("[+-]")) && parent->valueType() && parent->valueType()->pointer)
             parent = parent->astParent();
 
         // passing variable to subfunction?
-        if (Token::Match(parent, "[[(,{.]") || Token::Match(parent, "%oror%|&&") || (parent && parent->isUnaryOp("*")))
+        if (Token::Match(parent, MATCH_PATTERN("[[(,{.]")) || Token::Match(parent, "%oror%|&&") || (parent && parent->isUnaryOp("*")))
             ;
         else if (Token::simpleMatch(parent, ":")) {
             while (Token::Match(parent, "[?:]"))
@@ -2381,9 +2381,9 @@ static T* getTokenArgumentFunctionImpl(T* tok, int& argn)
     if (Token::simpleMatch(argtok, ","))
         argtok = argtok->astOperand1();
     tok = argtok;
-    while (Token::Match(tok->astParent(), ",|(|{")) {
+    while (Token::Match(tok->astParent(), MATCH_PATTERN(",|(|{"))) {
         tok = tok->astParent();
-        if (Token::Match(tok, "(|{"))
+        if (Token::Match(tok, MATCH_PATTERN("(|{")))
             break;
     }
     argn = getArgumentPos(tok, argtok);
@@ -2634,7 +2634,7 @@ bool isVariableChanged(const Token *tok, int indirect, const Settings &settings,
     const Token *tok2 = tok;
     int derefs = 0;
     while ((tok2->astParent() && tok2->astParent()->isUnaryOp("*")) ||
-           (Token::simpleMatch(tok2->astParent(), ".") && !Token::Match(tok2->astParent()->astParent(), "[(,]")) ||
+           (Token::simpleMatch(tok2->astParent(), ".") && !Token::Match(tok2->astParent()->astParent(), MATCH_PATTERN("[(,]"))) ||
            (tok2->astParent() && tok2->astParent()->isUnaryOp("&") && Token::simpleMatch(tok2->astParent()->astParent(), ".") && tok2->astParent()->astParent()->originalName()=="->") ||
            (Token::simpleMatch(tok2->astParent(), "[") && tok2 == tok2->astParent()->astOperand1()) ||
            (Token::simpleMatch(tok2->astParent(), "(") && tok2->astParent()->isCast())) {
@@ -2698,14 +2698,14 @@ bool isVariableChanged(const Token *tok, int indirect, const Settings &settings,
             return false;
     }
 
-    if (tok2->isCpp() && Token::Match(tok2->astParent(), ">>|&") && astIsRHS(tok2) && isLikelyStreamRead(tok2->astParent()))
+    if (tok2->isCpp() && Token::Match(tok2->astParent(), MATCH_PATTERN(">>|&")) && astIsRHS(tok2) && isLikelyStreamRead(tok2->astParent()))
         return true;
 
     if (isLikelyStream(tok2))
         return true;
 
     // Member function call
-    if (Token::Match(tok2->astParent(), ". %name%") && isFunctionCall(tok2->astParent()->next()) &&
+    if (Token::Match(tok2->astParent(), MATCH_PATTERN(". %name%")) && isFunctionCall(tok2->astParent()->next()) &&
         tok2->astParent()->astOperand1() == tok2) {
         // Member function cannot change what `this` points to
         if (indirect == 0 && astIsPointer(tok))
@@ -2758,27 +2758,27 @@ bool isVariableChanged(const Token *tok, int indirect, const Settings &settings,
     }
 
     // Member pointer
-    if (Token::Match(tok2->astParent(), ". * ( & %name% ::")) {
+    if (Token::Match(tok2->astParent(), MATCH_PATTERN(". * ( & %name% ::"))) {
         const Token* ftok = tok2->astParent()->linkAt(2)->previous();
         // TODO: Check for pointer to member variable
         if (!ftok->function() || !ftok->function()->isConst())
             return true;
     }
-    if (Token::Match(tok2->astParent(), ". * %name%")) // bailout
+    if (Token::Match(tok2->astParent(), MATCH_PATTERN(". * %name%"))) // bailout
         return true;
 
     if (Token::simpleMatch(tok2, "[") && astIsContainer(tok) && vt && vt->container && vt->container->stdAssociativeLike)
         return true;
 
     const Token *ftok = tok2;
-    while (ftok && (!Token::Match(ftok, "[({]") || ftok->isCast()))
+    while (ftok && (!Token::Match(ftok, MATCH_PATTERN("[({]")) || ftok->isCast()))
         ftok = ftok->astParent();
 
-    if (ftok && Token::Match(ftok->link(), ")|} !!{")) {
+    if (ftok && Token::Match(ftok->link(), MATCH_PATTERN(")|} !!{"))) {
         if (ftok->str() == "(" && Token::simpleMatch(ftok->astOperand1(), "[")) // operator() on array element, bail out
             return true;
         const Token * ptok = tok2;
-        while (Token::Match(ptok->astParent(), ".|::|["))
+        while (Token::Match(ptok->astParent(), MATCH_PATTERN(".|::|[")))
             ptok = ptok->astParent();
         int pindirect = indirect;
         if (indirect == 0 && astIsLHS(tok2) && Token::Match(ptok, ". %var%") && astIsPointer(ptok->next()))
@@ -2791,13 +2791,13 @@ bool isVariableChanged(const Token *tok, int indirect, const Settings &settings,
     }
 
     const Token *parent = tok2->astParent();
-    while (Token::Match(parent, ".|::"))
+    while (Token::Match(parent, MATCH_PATTERN(".|::")))
         parent = parent->astParent();
     if (parent && parent->tokType() == Token::eIncDecOp && (indirect == 0 || tok2 != tok))
         return true;
 
     // structured binding, nonconst reference variable in lhs
-    if (Token::Match(tok2->astParent(), ":|=") && tok2 == tok2->astParent()->astOperand2() && Token::simpleMatch(tok2->astParent()->previous(), "]")) {
+    if (Token::Match(tok2->astParent(), MATCH_PATTERN(":|=")) && tok2 == tok2->astParent()->astOperand2() && Token::simpleMatch(tok2->astParent()->previous(), "]")) {
         const Token *typeStart = tok2->astParent()->linkAt(-1)->previous();
         if (Token::simpleMatch(typeStart, "&"))
             typeStart = typeStart->previous();
@@ -3039,8 +3039,8 @@ bool isVariablesChanged(const Token* start,
 
 bool isThisChanged(const Token* tok, int indirect, const Settings& settings)
 {
-    if ((Token::Match(tok->previous(), "%name% (") && !Token::simpleMatch(tok->astOperand1(), ".")) ||
-        Token::Match(tok->tokAt(-3), "this . %name% (")) {
+    if ((Token::Match(tok->previous(), MATCH_PATTERN("%name% (")) && !Token::simpleMatch(tok->astOperand1(), ".")) ||
+        Token::Match(tok->tokAt(-3), MATCH_PATTERN("this . %name% ("))) {
         if (tok->previous()->function()) {
             return (!tok->previous()->function()->isConst() && !tok->previous()->function()->isStatic());
         }
@@ -3165,11 +3165,11 @@ const Token* findExpressionChangedSkipDeadCode(const Token* expr,
 const Token* getArgumentStart(const Token* ftok)
 {
     const Token* tok = ftok;
-    if (Token::Match(tok, "%name% (|{|)"))
+    if (Token::Match(tok, MATCH_PATTERN("%name% (|{|)")))
         tok = ftok->next();
     while (Token::simpleMatch(tok, ")"))
         tok = tok->next();
-    if (!Token::Match(tok, "(|{|["))
+    if (!Token::Match(tok, MATCH_PATTERN("(|{|[")))
         return nullptr;
     const Token* startTok = tok->astOperand2();
     if (!startTok && tok->next() != tok->link())
@@ -3326,7 +3326,7 @@ bool isLikelyStream(const Token *stream)
     if (!stream->isCpp())
         return false;
 
-    if (!Token::Match(stream->astParent(), "&|<<|>>") || !stream->astParent()->isBinaryOp())
+    if (!Token::Match(stream->astParent(), MATCH_PATTERN("&|<<|>>")) || !stream->astParent()->isBinaryOp())
         return false;
 
     if (stream->astParent()->astOperand1() != stream)
@@ -3376,7 +3376,7 @@ bool isConstVarExpression(const Token *tok, const std::function<bool(const Token
         return false;
     if (Token::simpleMatch(tok->previous(), "sizeof ("))
         return true;
-    if (Token::Match(tok->previous(), "%name% (")) {
+    if (Token::Match(tok->previous(), MATCH_PATTERN("%name% ("))) {
         if (Token::simpleMatch(tok->astOperand1(), ".") && !isConstVarExpression(tok->astOperand1(), skipPredicate))
             return false;
         std::vector<const Token *> args = getArguments(tok);
@@ -3389,18 +3389,18 @@ bool isConstVarExpression(const Token *tok, const std::function<bool(const Token
     if (isCPPCast(tok)) {
         return isConstVarExpression(tok->astOperand2(), skipPredicate);
     }
-    if (Token::Match(tok, "( %type%"))
+    if (Token::Match(tok, MATCH_PATTERN("( %type%")))
         return isConstVarExpression(tok->astOperand1(), skipPredicate);
     if (tok->str() == "::" && tok->hasKnownValue())
         return isConstVarExpression(tok->astOperand2(), skipPredicate);
-    if (Token::Match(tok, "%cop%|[|.")) {
+    if (Token::Match(tok, MATCH_PATTERN("%cop%|[|."))) {
         if (tok->astOperand1() && !isConstVarExpression(tok->astOperand1(), skipPredicate))
             return false;
         if (tok->astOperand2() && !isConstVarExpression(tok->astOperand2(), skipPredicate))
             return false;
         return true;
     }
-    if (Token::Match(tok, "%bool%|%num%|%str%|%char%|nullptr|NULL"))
+    if (Token::Match(tok, MATCH_PATTERN("%bool%|%num%|%str%|%char%|nullptr|NULL")))
         return true;
     if (tok->isEnumerator())
         return true;
@@ -3747,7 +3747,7 @@ bool isGlobalData(const Token *expr)
 
 bool isUnevaluated(const Token *tok)
 {
-    return Token::Match(tok, "alignof|_Alignof|_alignof|__alignof|__alignof__|decltype|offsetof|sizeof|typeid|typeof|__typeof__ (");
+    return Token::Match(tok, MATCH_PATTERN("alignof|_Alignof|_alignof|__alignof|__alignof__|decltype|offsetof|sizeof|typeid|typeof|__typeof__ ("));
 }
 
 static std::set<MathLib::bigint> getSwitchValues(const Token *startbrace, bool &hasDefault)
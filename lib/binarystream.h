@@ -0,0 +1,161 @@
+/* -*- C++ -*-
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//---------------------------------------------------------------------------
+#ifndef binarystreamH
+#define binarystreamH
+//---------------------------------------------------------------------------
+
+#include "config.h"
+#include "errortypes.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/// @addtogroup Core
+/// @{
+
+/**
+ * @brief Writes values into a compact binary buffer.
+ *
+ * Integers are stored as variable length quantities (LEB128). Interned
+ * strings are only transferred the first time they are written - after that
+ * only their index is written. The string table outlives clear() so a stream
+ * of records can share it.
+ */
+class BinaryWriter {
+public:
+    void writeUInt(std::uint64_t value) {
+        while (value >= 0x80) {
+            mData += static_cast<char>((value & 0x7f) | 0x80);
+            value >>= 7;
+        }
+        mData += static_cast<char>(value);
+    }
+
+    void writeInt(std::int64_t value) {
+        // zigzag encoding so small negative values stay small
+        writeUInt((static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+    }
+
+    void writeString(const std::string &str) {
+        writeUInt(str.size());
+        mData += str;
+    }
+
+    void writeInternedString(const std::string &str) {
+        const auto it = mStrings.find(str);
+        if (it != mStrings.cend()) {
+            writeUInt(it->second << 1);
+            return;
+        }
+        const std::uint64_t index = mStrings.size();
+        mStrings.emplace(str, index);
+        writeUInt((index << 1) | 1);
+        writeString(str);
+    }
+
+    const std::string &data() const {
+        return mData;
+    }
+
+    /** Clear the written data but keep the string table */
+    void clear() {
+        mData.clear();
+    }
+
+private:
+    std::string mData;
+    std::unordered_map<std::string, std::uint64_t> mStrings;
+};
+
+/**
+ * @brief Reads values written by BinaryWriter.
+ *
+ * The string table outlives setData() so the records of a stream can be read
+ * one after another.
+ * @throws InternalError when reading beyond the data or an invalid string index
+ */
+class BinaryReader {
+public:
+    void setData(const char *data, std::size_t size) {
+        mPos = data;
+        mEnd = data + size;
+    }
+
+    bool atEnd() const {
+        return mPos == mEnd;
+    }
+
+    /** The number of bytes which have not been read yet */
+    std::size_t remaining() const {
+        return static_cast<std::size_t>(mEnd - mPos);
+    }
+
+    std::uint64_t readUInt() {
+        std::uint64_t value = 0;
+        for (unsigned int shift = 0; shift < 64; shift += 7) {
+            if (mPos == mEnd)
+                throw InternalError(nullptr, "Internal Error: Binary deserialization failed - premature end of data");
+            const auto byte = static_cast<unsigned char>(*mPos++);
+            value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0)
+                return value;
+        }
+        throw InternalError(nullptr, "Internal Error: Binary deserialization failed - invalid integer");
+    }
+
+    std::int64_t readInt() {
+        const std::uint64_t value = readUInt();
+        return static_cast<std::int64_t>((value >> 1) ^ (~(value & 1) + 1));
+    }
+
+    std::string readString() {
+        const std::uint64_t len = readUInt();
+        if (len > static_cast<std::uint64_t>(mEnd - mPos))
+            throw InternalError(nullptr, "Internal Error: Binary deserialization failed - premature end of data");
+        std::string str(mPos, static_cast<std::size_t>(len));
+        mPos += len;
+        return str;
+    }
+
+    const std::string &readInternedString() {
+        const std::uint64_t value = readUInt();
+        const std::uint64_t index = value >> 1;
+        if (value & 1) {
+            if (index != mStrings.size())
+                throw InternalError(nullptr, "Internal Error: Binary deserialization failed - invalid string index");
+            mStrings.push_back(readString());
+        }
+        else if (index >= mStrings.size())
+            throw InternalError(nullptr, "Internal Error: Binary deserialization failed - unknown string index");
+        return mStrings[static_cast<std::size_t>(index)];
+    }
+
+private:
+    const char *mPos{};
+    const char *mEnd{};
+    std::vector<std::string> mStrings;
+};
+
+/// @}
+//---------------------------------------------------------------------------
+#endif // binarystreamH
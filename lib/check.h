@@ -22,6 +22,7 @@
 //---------------------------------------------------------------------------
 
 #include "config.h"
+#include "valueflow.h"
 
 #include <list>
 #include <string>
@@ -75,6 +76,14 @@ public:
     /** get information about this class, used to generate documentation */
     virtual std::string classInfo() const = 0;
 
+    /**
+     * Does the check use the given product of the ValueFlow analysis with these settings? The ValueFlow
+     * passes for products no check uses are skipped. By default a check uses the values in general.
+     */
+    virtual bool usesValueFlow(ValueFlow::Product product, const Settings& /*settings*/) const {
+        return product == ValueFlow::Product::values;
+    }
+
     /** Base class used for whole-program analysis */
     class CPPCHECKLIB FileInfo {
     public:
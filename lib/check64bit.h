@@ -56,6 +56,11 @@ private:
                "- assign address to/from int/long\n"
                "- casting address from/to integer when returning from function\n";
     }
+
+    /** The check does not use the values */
+    bool usesValueFlow(ValueFlow::Product /*product*/, const Settings& /*settings*/) const override {
+        return false;
+    }
 };
 
 class CPPCHECKLIB Check64BitPortabilityImpl : public CheckImpl {
@@ -53,6 +53,11 @@ private:
     std::string classInfo() const override {
         return "Warn if there are side effects in assert statements (since this cause different behaviour in debug/release builds).\n";
     }
+
+    /** The check does not use the values */
+    bool usesValueFlow(ValueFlow::Product /*product*/, const Settings& /*settings*/) const override {
+        return false;
+    }
 };
 
 class CPPCHECKLIB CheckAssertImpl : public CheckImpl {
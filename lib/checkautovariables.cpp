@@ -722,7 +722,7 @@ void CheckAutoVariablesImpl::checkVarLifetime()
 void CheckAutoVariablesImpl::errorReturnDanglingLifetime(const Token *tok, const ValueFlow::Value *val)
 {
     const bool inconclusive = val ? val->isInconclusive() : false;
-    ErrorPath errorPath = val ? val->errorPath : ErrorPath();
+    ErrorPath errorPath = val ? val->errorPath.toList() : ErrorPath();
     std::string msg = "Returning " + lifetimeMessage(tok, val, errorPath);
     errorPath.emplace_back(tok, "");
     reportError(std::move(errorPath), Severity::error, "returnDanglingLifetime", msg + " that will be invalid when returning.", CWE562, inconclusive ? Certainty::inconclusive : Certainty::normal);
@@ -731,7 +731,7 @@ void CheckAutoVariablesImpl::errorReturnDanglingLifetime(const Token *tok, const
 void CheckAutoVariablesImpl::errorInvalidLifetime(const Token *tok, const ValueFlow::Value* val)
 {
     const bool inconclusive = val ? val->isInconclusive() : false;
-    ErrorPath errorPath = val ? val->errorPath : ErrorPath();
+    ErrorPath errorPath = val ? val->errorPath.toList() : ErrorPath();
     std::string msg = "Using " + lifetimeMessage(tok, val, errorPath);
     errorPath.emplace_back(tok, "");
     reportError(std::move(errorPath), Severity::error, "invalidLifetime", msg + " that is out of scope.", CWE562, inconclusive ? Certainty::inconclusive : Certainty::normal);
@@ -740,7 +740,7 @@ void CheckAutoVariablesImpl::errorInvalidLifetime(const Token *tok, const ValueF
 void CheckAutoVariablesImpl::errorDanglingTemporaryLifetime(const Token* tok, const ValueFlow::Value* val, const Token* tempTok)
 {
     const bool inconclusive = val ? val->isInconclusive() : false;
-    ErrorPath errorPath = val ? val->errorPath : ErrorPath();
+    ErrorPath errorPath = val ? val->errorPath.toList() : ErrorPath();
     std::string msg = "Using " + lifetimeMessage(tok, val, errorPath);
     errorPath.emplace_back(tempTok, "Temporary created here.");
     errorPath.emplace_back(tok, "");
@@ -755,7 +755,7 @@ void CheckAutoVariablesImpl::errorDanglingTemporaryLifetime(const Token* tok, co
 void CheckAutoVariablesImpl::errorDanglngLifetime(const Token *tok, const ValueFlow::Value *val, bool isStatic)
 {
     const bool inconclusive = val ? val->isInconclusive() : false;
-    ErrorPath errorPath = val ? val->errorPath : ErrorPath();
+    ErrorPath errorPath = val ? val->errorPath.toList() : ErrorPath();
     std::string tokName = tok ? tok->expressionString() : "x";
     std::string msg = isStatic ? "Static" : "Non-local";
     msg += " variable '" + tokName + "' will use " + lifetimeMessage(tok, val, errorPath);
@@ -66,6 +66,11 @@ private:
                "- Unhandled exception specification when calling function foo()\n"
                "- Rethrow without currently handled exception\n";
     }
+
+    /** The check does not use the values */
+    bool usesValueFlow(ValueFlow::Product /*product*/, const Settings& /*settings*/) const override {
+        return false;
+    }
 };
 
 class CPPCHECKLIB CheckExceptionSafetyImpl : public CheckImpl {
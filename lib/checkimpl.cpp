@@ -53,7 +53,7 @@ ErrorPath CheckImpl::getErrorPath(const Token* errtok, const ValueFlow::Value* v
     if (!value) {
         errorPath.emplace_back(errtok, std::move(bug));
     } else if (mSettings.verbose || mSettings.outputFormat == Settings::OutputFormat::xml || !mSettings.templateLocation.empty()) {
-        errorPath = value->errorPath;
+        errorPath = value->errorPath.toList();
         errorPath.emplace_back(errtok, std::move(bug));
     } else {
         if (value->condition)
@@ -55,6 +55,11 @@ private:
         // checks there are. These checks are not intended for users.
         return "";
     }
+
+    /** The check does not use the values */
+    bool usesValueFlow(ValueFlow::Product /*product*/, const Settings& /*settings*/) const override {
+        return false;
+    }
 };
 
 class CPPCHECKLIB CheckInternalImpl : public CheckImpl {
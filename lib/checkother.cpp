@@ -772,7 +772,7 @@ void CheckOtherImpl::redundantAssignmentInSwitchError(const Token *tok1, const T
 
 void CheckOtherImpl::redundantAssignmentSameValueError(const Token *tok, const ValueFlow::Value* val, const std::string &var)
 {
-    auto errorPath = val->errorPath;
+    ErrorPath errorPath = val->errorPath.toList();
     errorPath.emplace_back(tok, "");
     reportError(std::move(errorPath), Severity::style, "redundantAssignment",
                 "$symbol:" + var + "\n"
@@ -4453,11 +4453,11 @@ void CheckOtherImpl::comparePointersError(const Token *tok, const ValueFlow::Val
     const char * const id = (verb[0] == 'C') ? "comparePointers" : "subtractPointers";
     if (v1) {
         errorPath.emplace_back(v1->tokvalue->variable()->nameToken(), "Variable declared here.");
-        errorPath.insert(errorPath.end(), v1->errorPath.cbegin(), v1->errorPath.cend());
+        errorPath.splice(errorPath.end(), v1->errorPath.toList());
     }
     if (v2) {
         errorPath.emplace_back(v2->tokvalue->variable()->nameToken(), "Variable declared here.");
-        errorPath.insert(errorPath.end(), v2->errorPath.cbegin(), v2->errorPath.cend());
+        errorPath.splice(errorPath.end(), v2->errorPath.toList());
     }
     errorPath.emplace_back(tok, "");
     reportError(
@@ -4793,6 +4793,15 @@ void CheckOtherImpl::overlappingWriteFunction(const Token *tok, const std::strin
     reportError(tok, Severity::error, "overlappingWriteFunction", "Overlapping read/write in " + funcname + "() is undefined behavior");
 }
 
+bool CheckOther::usesValueFlow(ValueFlow::Product product, const Settings &settings) const
+{
+    // the moved values are only used by checkAccessOfMovedVariable()
+    if (product == ValueFlow::Product::movedValues)
+        return settings.standards.cpp >= Standards::CPP11 &&
+               (settings.isPremiumEnabled("accessMoved") || settings.severity.isEnabled(Severity::warning));
+    return true;
+}
+
 void CheckOther::runChecks(const Tokenizer &tokenizer, ErrorLogger& errorLogger)
 {
     CheckOtherImpl checkOther(&tokenizer, tokenizer.getSettings(), errorLogger);
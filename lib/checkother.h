@@ -118,6 +118,8 @@ private:
                "- calculating modulo of one.\n"
                "- known function argument, suspicious calculation.\n";
     }
+
+    bool usesValueFlow(ValueFlow::Product product, const Settings &settings) const override;
 };
 
 class CPPCHECKLIB CheckOtherImpl : public CheckImpl {
@@ -52,6 +52,11 @@ private:
     std::string classInfo() const override {
         return "Warn if using postfix operators ++ or -- rather than prefix operator\n";
     }
+
+    /** The check does not use the values */
+    bool usesValueFlow(ValueFlow::Product /*product*/, const Settings& /*settings*/) const override {
+        return false;
+    }
 };
 
 class CPPCHECKLIB CheckPostfixOperatorImpl : public CheckImpl {
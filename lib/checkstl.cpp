@@ -1100,7 +1100,7 @@ static const ValueFlow::Value* getInnerLifetime(const Token* tok,
                 if (const ValueFlow::Value* v = getInnerLifetime(val.capturetok, id, errorPath, depth - 1))
                     return v;
             if (errorPath)
-                errorPath->insert(errorPath->end(), val.errorPath.cbegin(), val.errorPath.cend());
+                errorPath->splice(errorPath->end(), val.errorPath.toList());
             if (const ValueFlow::Value* v = getInnerLifetime(val.tokvalue, id, errorPath, depth - 1))
                 return v;
             continue;
@@ -1261,7 +1261,7 @@ void CheckStlImpl::invalidContainerError(const Token *tok, const ValueFlow::Valu
 {
     const bool inconclusive = val ? val->isInconclusive() : false;
     if (val)
-        errorPath.insert(errorPath.begin(), val->errorPath.cbegin(), val->errorPath.cend());
+        errorPath.splice(errorPath.begin(), val->errorPath.toList());
     std::string msg = "Using " + lifetimeMessage(tok, val, errorPath);
     errorPath.emplace_back(tok, "");
     reportError(std::move(errorPath), Severity::error, "invalidContainer", msg + " that may be invalid.", CWE664, inconclusive ? Certainty::inconclusive : Certainty::normal);
@@ -1578,11 +1578,11 @@ void CheckUninitVarImpl::uninitvarError(const Token* tok, const ValueFlow::Value
     if (tok && Token::simpleMatch(tok->astParent(), ".") && astIsRHS(tok))
         ltok = tok->astParent();
     const std::string& varname = ltok ? ltok->expressionString() : "x";
-    ErrorPath errorPath = v.errorPath;
+    ErrorPath errorPath = v.errorPath.toList();
     errorPath.emplace_back(tok, "");
     auto severity = v.isKnown() ? Severity::error : Severity::warning;
     auto certainty = v.isInconclusive() ? Certainty::inconclusive : Certainty::normal;
-    if (v.subexpressions.empty()) {
+    if (v.subexpressions().empty()) {
         reportError(std::move(errorPath),
                     severity,
                     "uninitvar",
@@ -1591,9 +1591,9 @@ void CheckUninitVarImpl::uninitvarError(const Token* tok, const ValueFlow::Value
                     certainty);
         return;
     }
-    std::string vars = v.subexpressions.size() == 1 ? "variable: " : "variables: ";
+    std::string vars = v.subexpressions().size() == 1 ? "variable: " : "variables: ";
     std::string prefix;
-    for (const std::string& var : v.subexpressions) {
+    for (const std::string& var : v.subexpressions()) {
         vars += prefix + varname + "." + var;
         prefix = ", ";
     }
@@ -1674,7 +1674,7 @@ void CheckUninitVarImpl::valueFlowUninit()
                 const ExprUsage usage = getExprUsage(tok, v->indirect, mSettings);
                 if (usage == ExprUsage::NotUsed || usage == ExprUsage::Inconclusive)
                     continue;
-                if (!v->subexpressions.empty() && usage == ExprUsage::PassedByReference)
+                if (!v->subexpressions().empty() && usage == ExprUsage::PassedByReference)
                     continue;
                 if (usage != ExprUsage::Used) {
                     if (!(Token::Match(tok->astParent(), ". %name% (|[") && uninitderef) &&
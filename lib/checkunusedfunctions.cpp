@@ -485,7 +485,11 @@ void CheckUnusedFunctions::analyseWholeProgram(const Settings &settings, ErrorLo
         }
     };
 
-    const std::string err = AnalyzerInformation::processFilesTxt(buildDir, handler, settings.debugainfo);
+    const auto filter = [](const char* checkattr) {
+        return std::strcmp(checkattr, "CheckUnusedFunctions") == 0;
+    };
+
+    const std::string err = AnalyzerInformation::processFilesTxt(buildDir, handler, settings.debugainfo, filter);
     if (!err.empty()) {
         const ErrorMessage errmsg({}, "", Severity::error, err, "internalError", Certainty::normal);
         errorLogger.reportErr(errmsg);
@@ -57,6 +57,11 @@ private:
                "- Using va_list before it is opened\n"
                "- Subsequent calls to va_start/va_copy()\n";
     }
+
+    /** The check does not use the values */
+    bool usesValueFlow(ValueFlow::Product /*product*/, const Settings& /*settings*/) const override {
+        return false;
+    }
 };
 
 class CPPCHECKLIB CheckVaargImpl : public CheckImpl
@@ -29,6 +29,7 @@
 #include "errorlogger.h"
 #include "errortypes.h"
 #include "filesettings.h"
+#include "headercache.h"
 #include "library.h"
 #include "path.h"
 #include "platform.h"
@@ -51,7 +52,9 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <condition_variable>
 #include <cstdio>
 #include <cstdint>
 #include <cstring>
@@ -60,9 +63,16 @@
 #include <ctime>
 #include <exception> // IWYU pragma: keep
 #include <fstream>
+#include <functional>
+#ifdef HAS_THREADING_MODEL_THREAD
+#include <future>
+#endif
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <new>
 #include <set>
 #include <sstream>
@@ -86,6 +96,19 @@ static constexpr char FILELIST[] = "cppcheck-addon-ctu-file-list";
 // CWE ids used
 static const CWE CWE398(398U);  // Indicator of Poor Code Quality
 
+using LocationMacros = std::map<std::pair<std::string, int>, std::set<std::string>>;
+
+/** What macros are used on a location? */
+static LocationMacros getLocationMacros(const Token* startTok, const std::vector<std::string>& files)
+{
+    LocationMacros locationMacros;
+    for (const Token* tok = startTok; tok; tok = tok->next()) {
+        if (!tok->getMacroName().empty())
+            locationMacros[std::make_pair(files[tok->fileIndex()], tok->linenr())].emplace(tok->getMacroName());
+    }
+    return locationMacros;
+}
+
 class CppCheck::CppCheckLogger : public ErrorLogger
 {
 public:
@@ -108,11 +131,12 @@ public:
 
     void setLocationMacros(const Token* startTok, const std::vector<std::string>& files)
     {
-        mLocationMacros.clear();
-        for (const Token* tok = startTok; tok; tok = tok->next()) {
-            if (!tok->getMacroName().empty())
-                mLocationMacros[Location(files[tok->fileIndex()], tok->linenr())].emplace(tok->getMacroName());
-        }
+        mLocationMacros = getLocationMacros(startTok, files);
+    }
+
+    void setLocationMacros(LocationMacros locationMacros)
+    {
+        mLocationMacros = std::move(locationMacros);
     }
 
     void resetExitCode()
@@ -288,7 +312,7 @@ private:
     std::vector<RemarkComment> mRemarkComments;
 
     using Location = std::pair<std::string, int>;
-    std::map<Location, std::set<std::string>> mLocationMacros; // What macros are used on a location?
+    LocationMacros mLocationMacros; // What macros are used on a location?
 
     std::ofstream mPlistFile;
     std::vector<std::string> mPlistFilenames;
@@ -756,7 +780,8 @@ unsigned int CppCheck::checkClang(const FileWithDetails &file)
                              const_cast<SymbolDatabase&>(*tokenizer.getSymbolDatabase()),
                              mErrorLogger,
                              mSettings,
-                             mTimerResults);
+                             mTimerResults,
+                             getValueFlowProducts());
         tokenizer.printDebugOutput(std::cout);
         checkNormalTokens(tokenizer, nullptr, ""); // TODO: provide analyzer information
 
@@ -869,6 +894,11 @@ unsigned int CppCheck::check(const FileSettings &fs)
 }
 
 std::size_t CppCheck::calculateHash(const Preprocessor& preprocessor, const std::string& filePath) const
+{
+    return preprocessor.calculateHash(getToolInfo(filePath));
+}
+
+std::string CppCheck::getToolInfo(const std::string& filePath) const
 {
     std::ostringstream toolinfo;
     toolinfo << (mSettings.cppcheckCfgProductName.empty() ? CPPCHECK_VERSION_STRING : mSettings.cppcheckCfgProductName);
@@ -878,6 +908,13 @@ std::size_t CppCheck::calculateHash(const Preprocessor& preprocessor, const std:
     toolinfo << (mSettings.severity.isEnabled(Severity::portability) ? 'p' : ' ');
     toolinfo << (mSettings.severity.isEnabled(Severity::information) ? 'i' : ' ');
     toolinfo << mSettings.userDefines;
+    for (const std::string &U : mSettings.userUndefs)
+        toolinfo << " -U" << U;
+    // the include paths and forced includes determine which files are included
+    for (const std::string &I : mSettings.includePaths)
+        toolinfo << " -I" << I;
+    for (const std::string &include : mSettings.userIncludes)
+        toolinfo << " --include=" << include;
     toolinfo << (mSettings.checkConfiguration ? 'c' : ' '); // --check-config
     toolinfo << (mSettings.force ? 'f' : ' ');
     toolinfo << mSettings.maxConfigsOption;
@@ -889,7 +926,7 @@ std::size_t CppCheck::calculateHash(const Preprocessor& preprocessor, const std:
     toolinfo << mSettings.premiumArgs;
     // TODO: do we need to add more options?
     mSuppressions.nomsg.dump(toolinfo, filePath);
-    return preprocessor.calculateHash(toolinfo.str());
+    return toolinfo.str();
 }
 
 unsigned int CppCheck::checkBuffer(const FileWithDetails &file, const std::string &cfgname, const char* data, std::size_t size)
@@ -897,7 +934,7 @@ unsigned int CppCheck::checkBuffer(const FileWithDetails &file, const std::strin
     const auto f = [&file, data, size](std::vector<std::string>& files, simplecpp::OutputList* outputList) {
         return simplecpp::TokenList{{data, size}, files, file.spath(), outputList};
     };
-    return checkInternal(file, cfgname, f);
+    return checkInternal(file, cfgname, f, true);
 }
 
 unsigned int CppCheck::checkFile(const FileWithDetails& file, const std::string &cfgname)
@@ -905,7 +942,7 @@ unsigned int CppCheck::checkFile(const FileWithDetails& file, const std::string
     const auto f = [&file](std::vector<std::string>& files, simplecpp::OutputList* outputList) {
         return simplecpp::TokenList{file.spath(), files, outputList};
     };
-    return checkInternal(file, cfgname, f);
+    return checkInternal(file, cfgname, f, false);
 }
 
 void CppCheck::checkPlistOutput(const FileWithDetails& file)
@@ -923,7 +960,32 @@ void CppCheck::checkPlistOutput(const FileWithDetails& file)
     }
 }
 
-unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::string &cfgname, const CreateTokenListFn& createTokenList)
+bool CppCheck::hasInlineSuppressions(const simplecpp::TokenList &tokens) const
+{
+    if (!mSettings.inlineSuppressions)
+        return false;
+    for (const simplecpp::Token *tok = tokens.cfront(); tok; tok = tok->next) {
+        if (tok->comment && tok->str().find("cppcheck-suppress") != std::string::npos)
+            return true;
+    }
+    return false;
+}
+
+struct CppCheck::PendingConfig
+{
+    PendingConfig(std::string cfg, TokenList list, int count)
+        : currentConfig(std::move(cfg))
+        , tokenlist(std::move(list))
+        , checkCount(count)
+    {}
+
+    std::string currentConfig;
+    TokenList tokenlist;
+    int checkCount;
+    std::string preprocessorDump;
+};
+
+unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::string &cfgname, const CreateTokenListFn& createTokenList, bool fromBuffer)
 {
     // TODO: move to constructor when CppCheck no longer owns the settings
     if (mSettings.checks.isEnabled(Checks::unusedFunction) && !mUnusedFunctionsCheck)
@@ -970,7 +1032,7 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
             // TODO: if an exception occurs in this block it will continue in an unexpected code path
             if (!mSettings.buildDir.empty())
             {
-                analyzerInformation.reset(new AnalyzerInformation);
+                analyzerInformation.reset(new AnalyzerInformation(mSettings.buildDirFormat == Settings::BuildDirFormat::BINARY));
                 mLogger->setAnalyzerInfo(analyzerInformation.get());
             }
 
@@ -1001,11 +1063,30 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
             return EXIT_SUCCESS;
         }
 
+        std::size_t toolInfo = 0;
+        if (!mSettings.buildDir.empty()) {
+            toolInfo = std::hash<std::string>{}(getToolInfo(file.spath()));
+
+            // the results can be reused without reading any file when none of the dependencies have changed
+            std::list<ErrorMessage> errors;
+            if (!fromBuffer && AnalyzerInformation::skipAnalysisByDependencies(mSettings.buildDir, file.spath(), cfgname, file.fsFileId(), toolInfo, errors, mSettings.debugainfo)) {
+                checkPlistOutput(file);
+                for (const ErrorMessage &errmsg : errors)
+                    mErrorLogger.reportErr(errmsg);
+                return mLogger->exitcode();
+            }
+        }
+
         simplecpp::OutputList outputList;
         std::vector<std::string> files;
         simplecpp::TokenList tokens1 = createTokenList(files, &outputList);
 
         Preprocessor preprocessor(tokens1, mSettings, mErrorLogger, file.lang());
+        if (mHeaderCache) {
+            preprocessor.setReadCallback([this](const std::string &path, std::vector<std::string> &filenames, simplecpp::OutputList *outputList) {
+                return mHeaderCache->read(path, filenames, outputList);
+            });
+        }
 
         if (preprocessor.reportOutput(outputList, true))
             return mLogger->exitcode();
@@ -1017,13 +1098,19 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
             dumpFooter += getDumpFileContentsRawTokensFooter(tokens1);
         }
 
+        // Suppressions and remark comments are not part of the cached results so the file
+        // needs to be read when the results are reused
+        const std::vector<RemarkComment> remarkComments = preprocessor.getRemarkComments();
+        const bool sourceDependency = !fromBuffer && remarkComments.empty() && !hasInlineSuppressions(tokens1);
+        bool reusableDependencies = true;
+
         // Parse comments and then remove them
-        mLogger->addRemarkComments(preprocessor.getRemarkComments());
+        mLogger->addRemarkComments(remarkComments);
         preprocessor.inlineSuppressions(mSuppressions.nomsg);
         preprocessor.removeComments();
 
         if (!mSettings.buildDir.empty()) {
-            analyzerInformation.reset(new AnalyzerInformation);
+            analyzerInformation.reset(new AnalyzerInformation(mSettings.buildDirFormat == Settings::BuildDirFormat::BINARY));
             mLogger->setAnalyzerInfo(analyzerInformation.get());
         }
 
@@ -1060,7 +1147,10 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
 
         preprocessor.setLoadCallback([&](simplecpp::FileData &data) {
             // Do preprocessing on included file
-            mLogger->addRemarkComments(preprocessor.getRemarkComments(data.tokens));
+            const std::vector<RemarkComment> includedRemarkComments = preprocessor.getRemarkComments(data.tokens);
+            if (!includedRemarkComments.empty() || hasInlineSuppressions(data.tokens))
+                reusableDependencies = false;
+            mLogger->addRemarkComments(includedRemarkComments);
             preprocessor.inlineSuppressions(data.tokens, mSuppressions.nomsg);
             Preprocessor::removeComments(data.tokens);
             Preprocessor::createDirectives(data.tokens, directives);
@@ -1125,6 +1215,16 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
         int checkCount = 0;
         bool hasValidConfig = false;
         std::list<std::string> configurationError;
+
+        // the configurations are preprocessed in order and checked afterwards
+        bool checkConfigsSimultaneously = mSettings.configJobs > 1 && configurations.size() > 1 && !mSettings.preprocessOnly;
+#ifdef HAVE_RULES
+        // TODO: support "raw" rules
+        if (hasRule("raw"))
+            checkConfigsSimultaneously = false;
+#endif
+        std::vector<PendingConfig> pendingConfigs;
+
         for (const std::string &currCfg : configurations) {
             // bail out if terminated
             if (Settings::terminated())
@@ -1200,9 +1300,21 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
             }
             hasValidConfig = true;
 
+            if (checkConfigsSimultaneously) {
+                pendingConfigs.emplace_back(std::move(currentConfig), std::move(tokenlist), checkCount);
+                // the preprocessor data depends on the configurations which have been processed so far
+                if ((mSettings.dump || !mSettings.addons.empty()) && fdump.is_open()) {
+                    std::ostringstream preprocessorDump;
+                    preprocessor.dump(preprocessorDump);
+                    pendingConfigs.back().preprocessorDump = preprocessorDump.str();
+                }
+                continue;
+            }
+
             Tokenizer tokenizer(std::move(tokenlist), mErrorLogger);
             try {
                 tokenizer.setTimerResults(mTimerResults);
+                tokenizer.setValueFlowProducts(getValueFlowProducts());
                 tokenizer.setDirectives(directives); // TODO: how to avoid repeated copies?
 
                 // locations macros
@@ -1232,15 +1344,9 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
 
                 // dump xml if --dump
                 if ((mSettings.dump || !mSettings.addons.empty()) && fdump.is_open()) {
-                    fdump << "<dump cfg=\"" << ErrorLogger::toxml(currentConfig) << "\">" << std::endl;
-                    fdump << "  <standards>" << std::endl;
-                    fdump << "    <c version=\"" << mSettings.standards.getC() << "\"/>" << std::endl;
-                    fdump << "    <cpp version=\"" << mSettings.standards.getCPP() << "\"/>" << std::endl;
-                    fdump << "  </standards>" << std::endl;
-                    fdump << getLibraryDumpData();
-                    preprocessor.dump(fdump);
-                    tokenizer.dump(fdump);
-                    fdump << "</dump>" << std::endl;
+                    std::ostringstream preprocessorDump;
+                    preprocessor.dump(preprocessorDump);
+                    dumpConfiguration(fdump, currentConfig, preprocessorDump.str(), tokenizer);
                 }
 
                 if (mSettings.inlineSuppressions) {
@@ -1267,6 +1373,9 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
             }
         }
 
+        if (!pendingConfigs.empty())
+            checkConfigurations(file, files, directives, pendingConfigs, fdump, analyzerInformation.get());
+
         if (!hasValidConfig && configurations.size() > 1 && mSettings.severity.isEnabled(Severity::information)) {
             std::string msg;
             msg = "This file is not analyzed. No working configuration could be extracted. Use -v for more details.";
@@ -1301,6 +1410,19 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
         }
 
         executeAddons(dumpFile, file);
+
+        if (analyzerInformation && reusableDependencies) {
+            // __has_include() does not use the file cache so the looked up files are unknown
+            const bool hasInclude = std::any_of(directives.cbegin(), directives.cend(), [](const Directive &directive) {
+                return directive.str.find("__has_include") != std::string::npos;
+            });
+            if (!hasInclude) {
+                std::set<std::string> includedFiles;
+                std::set<std::string> missingFiles;
+                preprocessor.getIncludedFiles(includedFiles, missingFiles);
+                analyzerInformation->setDependencies(toolInfo, sourceDependency ? file.spath() : "", includedFiles, missingFiles);
+            }
+        }
     } catch (const TerminateException &) {
         // Analysis is terminated
         if (analyzerInformation)
@@ -1333,6 +1455,246 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
     return mLogger->exitcode();
 }
 
+namespace {
+    /** Buffers everything reported for a configuration so it can be reported in order later on */
+    class ConfigLogger : public ErrorLogger
+    {
+    public:
+        ConfigLogger(ErrorLogger &errorLogger, std::mutex &progressSync)
+            : mErrorLogger(errorLogger)
+            , mProgressSync(progressSync)
+        {}
+
+        void reportOut(const std::string &outmsg, Color c) override
+        {
+            mOutput.emplace_back([=](ErrorLogger &errorLogger) {
+                errorLogger.reportOut(outmsg, c);
+            });
+        }
+
+        void reportErr(const ErrorMessage &msg) override
+        {
+            mOutput.emplace_back([=](ErrorLogger &errorLogger) {
+                errorLogger.reportErr(msg);
+            });
+        }
+
+        void reportMetric(const std::string &metric) override
+        {
+            mOutput.emplace_back([=](ErrorLogger &errorLogger) {
+                errorLogger.reportMetric(metric);
+            });
+        }
+
+        // the progress is not buffered as it is only meaningful while it is happening
+        void reportProgress(const std::string &filename, const char stage[], const std::size_t value) override
+        {
+            std::lock_guard<std::mutex> lg(mProgressSync);
+            mErrorLogger.reportProgress(filename, stage, value);
+        }
+
+        std::size_t size() const
+        {
+            return mOutput.size();
+        }
+
+        /** Report the buffered output in the range [begin, end) */
+        void flush(std::size_t begin, std::size_t end) const
+        {
+            std::lock_guard<std::mutex> lg(mProgressSync);
+            for (std::size_t i = begin; i < end && i < mOutput.size(); ++i)
+                mOutput[i](mErrorLogger);
+        }
+
+    private:
+        ErrorLogger &mErrorLogger;
+        std::mutex &mProgressSync;
+        std::vector<std::function<void(ErrorLogger&)>> mOutput;
+    };
+
+    /** The state of a configuration which is checked simultaneously */
+    struct ConfigJob
+    {
+        ConfigJob(std::string cfg, TokenList tokenlist, int count, std::string dump, ErrorLogger &errorLogger, std::mutex &progressSync)
+            : currentConfig(std::move(cfg))
+            , checkCount(count)
+            , preprocessorDump(std::move(dump))
+            , logger(errorLogger, progressSync)
+            , tokenizer(std::move(tokenlist), logger)
+        {}
+
+        std::string currentConfig;
+        int checkCount;
+        std::string preprocessorDump;
+        ConfigLogger logger;
+        Tokenizer tokenizer;
+        LocationMacros locationMacros;
+        bool simplified{};
+        std::size_t hash{};
+        /** output which is only reported if the configuration is not a duplicate */
+        std::size_t checksBegin = std::numeric_limits<std::size_t>::max();
+        bool checksCompleted{};
+        std::exception_ptr exception;
+        bool done{};
+    };
+}
+
+void CppCheck::checkConfigurations(const FileWithDetails& file, const std::vector<std::string>& files, const std::list<Directive>& directives, std::vector<PendingConfig>& configs, std::ofstream& fdump, AnalyzerInformation* analyzerInformation)
+{
+    std::mutex progressSync;
+
+    std::vector<std::unique_ptr<ConfigJob>> jobs;
+    jobs.reserve(configs.size());
+    for (PendingConfig &config : configs)
+        jobs.emplace_back(new ConfigJob(std::move(config.currentConfig), std::move(config.tokenlist), config.checkCount, std::move(config.preprocessorDump), mErrorLogger, progressSync));
+    configs.clear();
+
+    // the results of the first configuration with a specific simplified token list are used
+    std::mutex hashSync;
+    std::map<std::size_t, std::size_t> hashOwner;
+
+    const std::set<ValueFlow::Product> valueFlowProducts = getValueFlowProducts();
+
+    const auto analyse = [&](std::size_t index) {
+        ConfigJob &job = *jobs[index];
+        Tokenizer &tokenizer = job.tokenizer;
+        try {
+            tokenizer.setTimerResults(mTimerResults);
+            tokenizer.setValueFlowProducts(valueFlowProducts);
+            tokenizer.setDirectives(directives); // TODO: how to avoid repeated copies?
+
+            job.locationMacros = getLocationMacros(tokenizer.tokens(), files);
+
+            if (!tokenizer.tokens())
+                return;
+
+            // Simplify tokens into normal form, skip rest if failed
+            if (!tokenizer.simplifyTokens1(job.currentConfig, file.fsFileId()))
+                return;
+            job.simplified = true;
+
+            job.hash = tokenizer.list.calculateHash();
+            bool duplicate;
+            {
+                std::lock_guard<std::mutex> lg(hashSync);
+                const auto it = hashOwner.find(job.hash);
+                duplicate = it != hashOwner.end() && it->second < index;
+                if (!duplicate)
+                    hashOwner[job.hash] = index;
+            }
+            if (duplicate)
+                return;
+
+            job.checksBegin = job.logger.size();
+            const ProgressReporter progressReporter(job.logger, mSettings.reportProgress, tokenizer.list.getSourceFilePath(), "Run checkers");
+            job.checksCompleted = runChecks(tokenizer, job.logger);
+        } catch (const InternalError &e) {
+            job.logger.reportErr(ErrorMessage::fromInternalError(e, &tokenizer.list, file.spath()));
+        } catch (...) {
+            job.exception = std::current_exception();
+        }
+    };
+
+    std::mutex doneSync;
+    std::condition_variable doneCond;
+    std::atomic<bool> aborted{false};
+
+#ifdef HAS_THREADING_MODEL_THREAD
+    std::atomic<std::size_t> nextJob{0};
+    const auto threadProc = [&]() {
+        std::size_t index;
+        while ((index = nextJob++) < jobs.size()) {
+            if (!aborted && !Settings::terminated())
+                analyse(index);
+            {
+                std::lock_guard<std::mutex> lg(doneSync);
+                jobs[index]->done = true;
+            }
+            doneCond.notify_all();
+        }
+    };
+
+    std::vector<std::future<void>> threadFutures;
+    const std::size_t threadCount = std::min<std::size_t>(mSettings.configJobs, jobs.size());
+    for (std::size_t i = 0; i < threadCount; ++i)
+        threadFutures.emplace_back(std::async(std::launch::async, threadProc));
+#else
+    for (std::size_t index = 0; index < jobs.size(); ++index) {
+        if (!Settings::terminated())
+            analyse(index);
+        jobs[index]->done = true;
+    }
+#endif
+
+    // report the results in the order of the configurations
+    for (std::size_t index = 0; index < jobs.size(); ++index) {
+        {
+            std::unique_lock<std::mutex> lock(doneSync);
+            doneCond.wait(lock, [&]() {
+                return jobs[index]->done;
+            });
+        }
+
+        // the tokens are no longer needed after this iteration
+        const std::unique_ptr<ConfigJob> job = std::move(jobs[index]);
+        Tokenizer &tokenizer = job->tokenizer;
+
+        mLogger->setLocationMacros(std::move(job->locationMacros));
+
+        // If only errors are printed, print filename after the check
+        if (!mSettings.quiet && (!job->currentConfig.empty() || job->checkCount > 1)) {
+            std::string fixedpath = Path::toNativeSeparators(file.spath());
+            mErrorLogger.reportOut("Checking " + fixedpath + ": " + job->currentConfig + "...", Color::FgGreen);
+        }
+
+        job->logger.flush(0, job->checksBegin);
+
+        if (job->exception) {
+            aborted = true;
+            std::rethrow_exception(job->exception);
+        }
+
+        if (Settings::terminated())
+            break;
+
+        if (!job->simplified)
+            continue;
+
+        try {
+            // dump xml if --dump
+            if ((mSettings.dump || !mSettings.addons.empty()) && fdump.is_open())
+                dumpConfiguration(fdump, job->currentConfig, job->preprocessorDump, tokenizer);
+
+            if (mSettings.inlineSuppressions) {
+                // Need to call this even if the hash will skip this configuration
+                mSuppressions.nomsg.markUnmatchedInlineSuppressionsAsChecked(tokenizer.list);
+            }
+
+            // Skip if we already met the same simplified token list
+            bool duplicate;
+            {
+                std::lock_guard<std::mutex> lg(hashSync);
+                duplicate = hashOwner[job->hash] != index;
+            }
+            if (duplicate) {
+                if (mSettings.debugwarnings)
+                    purgedConfigurationMessage(file.spath(), job->currentConfig);
+                continue;
+            }
+
+            job->logger.flush(job->checksBegin, job->logger.size());
+
+            if (job->checksCompleted)
+                collectFileInfo(tokenizer, analyzerInformation, job->currentConfig);
+        } catch (const InternalError &e) {
+            ErrorMessage errmsg = ErrorMessage::fromInternalError(e, &tokenizer.list, file.spath());
+            mErrorLogger.reportErr(errmsg);
+        }
+    }
+
+    aborted = true;
+}
+
 // TODO: replace with ErrorMessage::fromInternalError()
 void CppCheck::internalError(const std::string &filename, const std::string &msg)
 {
@@ -1358,39 +1720,74 @@ void CppCheck::checkNormalTokens(const Tokenizer &tokenizer, AnalyzerInformation
 {
     const ProgressReporter progressReporter(mErrorLogger, mSettings.reportProgress, tokenizer.list.getSourceFilePath(), "Run checkers");
 
-    CheckUnusedFunctions unusedFunctionsChecker;
+    if (!runChecks(tokenizer, mErrorLogger))
+        return;
 
+    collectFileInfo(tokenizer, analyzerInformation, currentConfig);
+}
+
+bool CppCheck::runChecks(const Tokenizer &tokenizer, ErrorLogger &errorLogger)
+{
     // TODO: this should actually be the behavior if only "--enable=unusedFunction" is specified - see #10648
     // TODO: log message when this is active?
-    const bool doUnusedFunctionOnly = Settings::unusedFunctionOnly();
+    if (Settings::unusedFunctionOnly())
+        return true;
 
-    if (!doUnusedFunctionOnly) {
-        const std::time_t maxTime = mSettings.checksMaxTime > 0 ? std::time(nullptr) + mSettings.checksMaxTime : 0;
+    const std::time_t maxTime = mSettings.checksMaxTime > 0 ? std::time(nullptr) + mSettings.checksMaxTime : 0;
+
+    // call all "runChecks" in all registered Check classes
+    for (Check * const c : CheckInstances::get()) {
+        if (Settings::terminated())
+            return false;
+
+        if (maxTime > 0 && std::time(nullptr) > maxTime) {
+            if (mSettings.debugwarnings) {
+                ErrorMessage::FileLocation loc(tokenizer.list.getFiles()[0], 0, 0);
+                ErrorMessage errmsg({std::move(loc)},
+                                    "",
+                                    Severity::debug,
+                                    "Checks maximum time exceeded",
+                                    "checksMaxTime",
+                                    Certainty::normal);
+                errorLogger.reportErr(errmsg);
+            }
+            return false;
+        }
 
-        // call all "runChecks" in all registered Check classes
-        for (Check * const c : CheckInstances::get()) {
-            if (Settings::terminated())
-                return;
+        Timer::run(c->name() + "::runChecks", mTimerResults, [&]() {
+            c->runChecks(tokenizer, errorLogger);
+        });
+    }
+    return true;
+}
 
-            if (maxTime > 0 && std::time(nullptr) > maxTime) {
-                if (mSettings.debugwarnings) {
-                    ErrorMessage::FileLocation loc(tokenizer.list.getFiles()[0], 0, 0);
-                    ErrorMessage errmsg({std::move(loc)},
-                                        "",
-                                        Severity::debug,
-                                        "Checks maximum time exceeded",
-                                        "checksMaxTime",
-                                        Certainty::normal);
-                    mErrorLogger.reportErr(errmsg);
-                }
-                return;
-            }
+std::set<ValueFlow::Product> CppCheck::getValueFlowProducts() const
+{
+    // the dump files and the debug output contain all values
+    if (mSettings.dump || !mSettings.addons.empty() || mSettings.debugnormal || mSettings.debugvalueflow || mSettings.debugwarnings)
+        return ValueFlow::getAllProducts();
 
-            Timer::run(c->name() + "::runChecks", mTimerResults, [&]() {
-                c->runChecks(tokenizer, mErrorLogger);
-            });
-        }
+    std::set<ValueFlow::Product> products;
+
+    // TODO: this should actually be the behavior if only "--enable=unusedFunction" is specified - see #10648
+    if (Settings::unusedFunctionOnly())
+        return products;
+
+    for (const ValueFlow::Product product : ValueFlow::getAllProducts()) {
+        const bool used = std::any_of(CheckInstances::get().cbegin(), CheckInstances::get().cend(), [&](const Check* c) {
+            return c->usesValueFlow(product, mSettings);
+        });
+        if (used)
+            products.insert(product);
     }
+    return products;
+}
+
+void CppCheck::collectFileInfo(const Tokenizer &tokenizer, AnalyzerInformation* analyzerInformation, const std::string& currentConfig)
+{
+    CheckUnusedFunctions unusedFunctionsChecker;
+
+    const bool doUnusedFunctionOnly = Settings::unusedFunctionOnly();
 
     if (mSettings.checks.isEnabled(Checks::unusedFunction) && !mSettings.buildDir.empty()) {
         unusedFunctionsChecker.parseTokens(tokenizer, mSettings.library);
@@ -1439,6 +1836,19 @@ void CppCheck::checkNormalTokens(const Tokenizer &tokenizer, AnalyzerInformation
 #endif
 }
 
+void CppCheck::dumpConfiguration(std::ostream &fdump, const std::string &currentConfig, const std::string &preprocessorDump, const Tokenizer &tokenizer) const
+{
+    fdump << "<dump cfg=\"" << ErrorLogger::toxml(currentConfig) << "\">" << std::endl;
+    fdump << "  <standards>" << std::endl;
+    fdump << "    <c version=\"" << mSettings.standards.getC() << "\"/>" << std::endl;
+    fdump << "    <cpp version=\"" << mSettings.standards.getCPP() << "\"/>" << std::endl;
+    fdump << "  </standards>" << std::endl;
+    fdump << getLibraryDumpData();
+    fdump << preprocessorDump;
+    tokenizer.dump(fdump);
+    fdump << "</dump>" << std::endl;
+}
+
 //---------------------------------------------------------------------------
 
 #ifdef HAVE_RULES
@@ -1900,7 +2310,12 @@ unsigned int CppCheck::analyseWholeProgram(const std::string &buildDir, const st
         }
     };
 
-    const std::string err = AnalyzerInformation::processFilesTxt(buildDir, handler, mSettings.debugainfo);
+    // the data of CheckUnusedFunctions is processed separately
+    const auto filter = [](const char* checkattr) {
+        return std::strcmp(checkattr, "CheckUnusedFunctions") != 0;
+    };
+
+    const std::string err = AnalyzerInformation::processFilesTxt(buildDir, handler, mSettings.debugainfo, filter);
     if (!err.empty()) {
         const ErrorMessage errmsg({}, "", Severity::error, err, "internalError", Certainty::normal);
         mErrorLogger.reportErr(errmsg);
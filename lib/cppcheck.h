@@ -26,8 +26,10 @@
 
 #include <cstddef>
 #include <functional>
+#include <iosfwd>
 #include <list>
 #include <memory>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -43,7 +45,9 @@ class ErrorLogger;
 class Settings;
 struct Suppressions;
 class Preprocessor;
+struct Directive;
 class TimerResults;
+class HeaderCache;
 
 namespace simplecpp {
     class TokenList;
@@ -144,6 +148,15 @@ public:
     /** analyse whole program use .analyzeinfo files or ctuinfo string */
     unsigned int analyseWholeProgram(const std::string &buildDir, const std::list<FileWithDetails> &files, const std::list<FileSettings>& fileSettings, const std::string& ctuInfo);
 
+    /**
+     * @brief Use a cache for the raw tokens of included files.
+     * The cache can be shared by several instances and must outlive the checking.
+     * @param headerCache the cache or nullptr to read the files for every translation unit
+     */
+    void setHeaderCache(HeaderCache* headerCache) {
+        mHeaderCache = headerCache;
+    }
+
 private:
     void purgedConfigurationMessage(const std::string &file, const std::string& configuration);
 
@@ -178,6 +191,13 @@ private:
      */
     std::size_t calculateHash(const Preprocessor &preprocessor, const std::string& filePath = {}) const;
 
+    /**
+     * @brief Get the options which affect the analysis of a file.
+     * @param filePath the file - used to select the suppressions
+     * @return the options as a string
+     */
+    std::string getToolInfo(const std::string& filePath) const;
+
     /**
      * @brief Check a file
      * @param file the file
@@ -188,6 +208,9 @@ private:
 
     void checkPlistOutput(const FileWithDetails& file);
 
+    /** Does the file contain inline suppressions which need to be parsed */
+    bool hasInlineSuppressions(const simplecpp::TokenList &tokens) const;
+
     /**
      * @brief Check a file using buffer
      * @param file the file
@@ -206,9 +229,10 @@ private:
      * @param file the file
      * @param cfgname  cfg name
      * @param createTokenList a function to create the simplecpp::TokenList with
+     * @param fromBuffer the file content is not read from the disk
      * @return number of errors found
      */
-    unsigned int checkInternal(const FileWithDetails& file, const std::string &cfgname, const CreateTokenListFn& createTokenList);
+    unsigned int checkInternal(const FileWithDetails& file, const std::string &cfgname, const CreateTokenListFn& createTokenList, bool fromBuffer);
 
     /**
      * @brief Check normal tokens
@@ -217,6 +241,46 @@ private:
      */
     void checkNormalTokens(const Tokenizer &tokenizer, AnalyzerInformation* analyzerInformation, const std::string& currentConfig);
 
+    /**
+     * @brief Run all registered checks on the tokens
+     * @param tokenizer tokenizer instance
+     * @param errorLogger the logger to report the findings to
+     * @return false if the checks were not completed
+     */
+    bool runChecks(const Tokenizer &tokenizer, ErrorLogger &errorLogger);
+
+    /**
+     * @brief Collect the information used by the whole program analysis
+     * @param tokenizer tokenizer instance
+     * @param analyzerInformation the analyzer information
+     */
+    void collectFileInfo(const Tokenizer &tokenizer, AnalyzerInformation* analyzerInformation, const std::string& currentConfig);
+
+    /**
+     * @brief What the checks, addons and dumps need from the ValueFlow analysis
+     */
+    std::set<ValueFlow::Product> getValueFlowProducts() const;
+
+    /**
+     * @brief Write the dump data of a configuration
+     */
+    void dumpConfiguration(std::ostream &fdump, const std::string &currentConfig, const std::string &preprocessorDump, const Tokenizer &tokenizer) const;
+
+    /** A preprocessed configuration which still needs to be checked */
+    struct PendingConfig;
+
+    /**
+     * @brief Check preprocessed configurations simultaneously (--config-jobs)
+     * The results are reported in the order of the configurations.
+     * @param file the file
+     * @param files the files used by the preprocessor
+     * @param directives the directives of the file
+     * @param configs the configurations to check
+     * @param fdump the dump file
+     * @param analyzerInformation the analyzer information
+     */
+    void checkConfigurations(const FileWithDetails& file, const std::vector<std::string>& files, const std::list<Directive>& directives, std::vector<PendingConfig>& configs, std::ofstream& fdump, AnalyzerInformation* analyzerInformation);
+
     /**
      * Execute addons
      */
@@ -250,6 +314,8 @@ private:
     ErrorLogger& mErrorLoggerDirect;
     TimerResults* mTimerResults;
 
+    HeaderCache* mHeaderCache{};
+
     bool mUseGlobalSuppressions;
 
     /** File info used for whole program analysis */
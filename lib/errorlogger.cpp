@@ -18,6 +18,7 @@
 
 #include "errorlogger.h"
 
+#include "binarystream.h"
 #include "color.h"
 #include "cppcheck.h"
 #include "path.h"
@@ -435,6 +436,56 @@ void ErrorMessage::deserialize(const std::string &data)
     }
 }
 
+void ErrorMessage::serialize(BinaryWriter &writer) const
+{
+    writer.writeInternedString(id);
+    writer.writeInternedString(severityToString(severity));
+    writer.writeUInt(cwe.id);
+    writer.writeUInt(hash);
+    writer.writeInternedString(fixInvalidChars(remark));
+    writer.writeInternedString(file0);
+    writer.writeUInt(certainty == Certainty::inconclusive ? 1 : 0);
+    writer.writeInternedString(fixInvalidChars(mShortMessage));
+    writer.writeInternedString(fixInvalidChars(mVerboseMessage));
+    writer.writeInternedString(mSymbolNames);
+
+    writer.writeUInt(callStack.size());
+    for (const FileLocation &loc : callStack) {
+        writer.writeInt(loc.line);
+        writer.writeUInt(loc.column);
+        writer.writeInternedString(loc.getfile(false));
+        writer.writeInternedString(loc.getOrigFile(false));
+        writer.writeInternedString(loc.getinfo());
+    }
+}
+
+void ErrorMessage::deserialize(BinaryReader &reader)
+{
+    id = reader.readInternedString();
+    severity = severityFromString(reader.readInternedString());
+    cwe.id = static_cast<unsigned short>(reader.readUInt());
+    hash = reader.readUInt();
+    remark = reader.readInternedString();
+    file0 = reader.readInternedString();
+    certainty = reader.readUInt() ? Certainty::inconclusive : Certainty::normal;
+    mShortMessage = reader.readInternedString();
+    mVerboseMessage = reader.readInternedString();
+    mSymbolNames = reader.readInternedString();
+
+    callStack.clear();
+    const std::uint64_t stackSize = reader.readUInt();
+    for (std::uint64_t i = 0; i < stackSize; ++i) {
+        const auto line = static_cast<int>(reader.readInt());
+        const auto column = static_cast<unsigned int>(reader.readUInt());
+        std::string file = reader.readInternedString();
+        const std::string origFile = reader.readInternedString();
+        std::string info = reader.readInternedString();
+        ErrorMessage::FileLocation loc(origFile, std::move(info), line, column);
+        loc.setfile(std::move(file));
+        callStack.push_back(std::move(loc));
+    }
+}
+
 std::string ErrorMessage::getXMLHeader(std::string productName, int xmlVersion)
 {
     const auto nameAndVersion = Settings::getNameAndVersion(productName);
@@ -36,6 +36,8 @@
 
 class Token;
 class TokenList;
+class BinaryReader;
+class BinaryWriter;
 enum class ReportType : std::uint8_t;
 enum class Color : std::uint8_t;
 
@@ -164,6 +166,16 @@ public:
      */
     void deserialize(const std::string &data);
 
+    /**
+     * Serialize this message into a binary stream - strings are interned so
+     * repeated file names, ids and messages are only transferred once.
+     */
+    void serialize(BinaryWriter &writer) const;
+    /**
+     * @throws InternalError thrown if deserialization failed
+     */
+    void deserialize(BinaryReader &reader);
+
     std::list<FileLocation> callStack;
     std::string id;
 
@@ -37,7 +37,7 @@ static bool findTokensSkipDeadCodeImpl(const Library& library,
             if (found(tok))
                 return true;
         }
-        if (Token::Match(tok, "if|for|while (") && Token::simpleMatch(tok->linkAt(1), ") {")) {
+        if (Token::Match(tok, MATCH_PATTERN("if|for|while (")) && Token::simpleMatch(tok->linkAt(1), ") {")) {
             const Token* condTok = getCondTok(tok);
             if (!condTok)
                 continue;
@@ -69,7 +69,7 @@ static bool findTokensSkipDeadCodeImpl(const Library& library,
                     return true;
                 tok = thenStart->link();
             }
-        } else if (Token::Match(tok->astParent(), "&&|?|%oror%") && astIsLHS(tok)) {
+        } else if (Token::Match(tok->astParent(), MATCH_PATTERN("&&|?|%oror%")) && astIsLHS(tok)) {
             auto result = evaluate(tok);
             if (result.empty())
                 continue;
@@ -131,9 +131,9 @@ namespace {
 
         template<class T, class F, REQUIRES("T must be a Token class", std::is_convertible<T*, const Token*> )>
         Progress traverseTok(T* tok, const F &f, bool traverseUnknown, T** out = nullptr) {
-            if (Token::Match(tok, "asm|goto"))
+            if (Token::Match(tok, MATCH_PATTERN("asm|goto")))
                 return Break(Analyzer::Terminate::Bail);
-            if (Token::Match(tok, "setjmp|longjmp (")) {
+            if (Token::Match(tok, MATCH_PATTERN("setjmp|longjmp ("))) {
                 // Traverse the parameters of the function before escaping
                 traverseRecursive(tok->next()->astOperand2(), f, traverseUnknown);
                 return Break(Analyzer::Terminate::Bail);
@@ -144,11 +144,11 @@ namespace {
                 // If we are in a loop then jump to the end
                 if (out)
                     *out = loopEnds.back();
-            } else if (Token::Match(tok, "return|throw")) {
+            } else if (Token::Match(tok, MATCH_PATTERN("return|throw"))) {
                 traverseRecursive(tok->astOperand2(), f, traverseUnknown);
                 traverseRecursive(tok->astOperand1(), f, traverseUnknown);
                 return Break(Analyzer::Terminate::Escape);
-            } else if (Token::Match(tok, "%name% (") && isEscapeFunction(tok, settings.library)) {
+            } else if (Token::Match(tok, MATCH_PATTERN("%name% (")) && isEscapeFunction(tok, settings.library)) {
                 // Traverse the parameters of the function before escaping
                 traverseRecursive(tok->next()->astOperand2(), f, traverseUnknown);
                 return Break(Analyzer::Terminate::Escape);
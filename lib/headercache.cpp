@@ -0,0 +1,182 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "headercache.h"
+
+#include <cstdint>
+#include <iterator>
+#include <sys/stat.h>
+#include <utility>
+
+#include <simplecpp.h>
+
+struct HeaderCache::Entry {
+    Entry(const std::string &path, std::int64_t mtime, std::int64_t fileSize)
+        : mtime(mtime)
+        , fileSize(fileSize)
+        , tokens(path, files, &outputList)
+    {}
+
+    std::int64_t mtime;
+    std::int64_t fileSize;
+    /** the filenames the file indexes of the tokens refer to */
+    std::vector<std::string> files;
+    simplecpp::OutputList outputList;
+    simplecpp::TokenList tokens;
+    /** estimated memory used by the entry */
+    std::size_t size{};
+};
+
+static bool getFileStat(const std::string &path, std::int64_t &mtime, std::int64_t &fileSize)
+{
+    struct stat file_stat;
+    if (stat(path.c_str(), &file_stat) == -1)
+        return false;
+    if ((file_stat.st_mode & S_IFMT) != S_IFREG)
+        return false;
+    mtime = file_stat.st_mtime;
+    fileSize = file_stat.st_size;
+    return true;
+}
+
+static std::size_t estimateSize(const simplecpp::TokenList &tokens, const simplecpp::OutputList &outputList, const std::vector<std::string> &files)
+{
+    std::size_t size = 0;
+    for (const simplecpp::Token *tok = tokens.cfront(); tok; tok = tok->next)
+        size += sizeof(simplecpp::Token) + tok->str().capacity();
+    for (const simplecpp::Output &output : outputList)
+        size += sizeof(simplecpp::Output) + output.msg.capacity();
+    for (const std::string &f : files)
+        size += sizeof(std::string) + f.capacity();
+    return size;
+}
+
+HeaderCache::HeaderCache(std::size_t maxSize)
+    : mMaxSize(maxSize)
+{}
+
+HeaderCache::~HeaderCache() = default;
+
+simplecpp::TokenList HeaderCache::read(const std::string &path, std::vector<std::string> &filenames, simplecpp::OutputList *outputList)
+{
+    std::int64_t mtime;
+    std::int64_t fileSize;
+    if (!getFileStat(path, mtime, fileSize))
+        return {path, filenames, outputList};
+
+    std::shared_ptr<const Entry> entry;
+    {
+        std::lock_guard<std::mutex> l(mSync);
+        const auto it = mEntries.find(path);
+        if (it != mEntries.end()) {
+            if (it->second.first->mtime == mtime && it->second.first->fileSize == fileSize) {
+                entry = it->second.first;
+                mLru.splice(mLru.end(), mLru, it->second.second);
+            } else {
+                // the file has been modified
+                mSize -= it->second.first->size;
+                mLru.erase(it->second.second);
+                mEntries.erase(it);
+            }
+        }
+    }
+
+    if (entry) {
+        ++mHits;
+    } else {
+        ++mMisses;
+
+        // read the file without holding the lock
+        auto newEntry = std::make_shared<Entry>(path, mtime, fileSize);
+        newEntry->size = sizeof(Entry) + estimateSize(newEntry->tokens, newEntry->outputList, newEntry->files);
+        entry = newEntry;
+        insert(path, std::move(newEntry));
+    }
+
+    // map the file indexes of the entry to the filenames of the translation unit
+    std::vector<unsigned int> fileIndexes;
+    fileIndexes.reserve(entry->files.size());
+    for (const std::string &f : entry->files) {
+        unsigned int index = 0;
+        while (index < filenames.size() && filenames[index] != f)
+            ++index;
+        if (index == filenames.size())
+            filenames.push_back(f);
+        fileIndexes.push_back(index);
+    }
+
+    simplecpp::TokenList tokens(filenames);
+    for (const simplecpp::Token *tok = entry->tokens.cfront(); tok; tok = tok->next) {
+        auto *newtok = new simplecpp::Token(*tok);
+        newtok->location.fileIndex = fileIndexes[tok->location.fileIndex];
+        tokens.push_back(newtok);
+    }
+    if (outputList) {
+        for (const simplecpp::Output &output : entry->outputList) {
+            outputList->push_back(output);
+            if (output.location.fileIndex < fileIndexes.size())
+                outputList->back().location.fileIndex = fileIndexes[output.location.fileIndex];
+        }
+    }
+    return tokens;
+}
+
+void HeaderCache::insert(const std::string &path, std::shared_ptr<const Entry> entry)
+{
+    if (entry->size > mMaxSize)
+        return;
+
+    std::lock_guard<std::mutex> l(mSync);
+    const auto it = mEntries.find(path);
+    if (it != mEntries.end()) {
+        // the file has been read by another thread in the meantime
+        mSize -= it->second.first->size;
+        mLru.erase(it->second.second);
+        mEntries.erase(it);
+    }
+    while (!mLru.empty() && mSize + entry->size > mMaxSize) {
+        const auto lru = mEntries.find(mLru.front());
+        mSize -= lru->second.first->size;
+        mEntries.erase(lru);
+        mLru.pop_front();
+    }
+    mSize += entry->size;
+    mLru.push_back(path);
+    mEntries.emplace(path, std::make_pair(std::move(entry), std::prev(mLru.end())));
+}
+
+void HeaderCache::clear()
+{
+    std::lock_guard<std::mutex> l(mSync);
+    mEntries.clear();
+    mLru.clear();
+    mSize = 0;
+}
+
+std::size_t HeaderCache::size() const
+{
+    std::lock_guard<std::mutex> l(mSync);
+    return mSize;
+}
+
+std::size_t HeaderCache::count() const
+{
+    std::lock_guard<std::mutex> l(mSync);
+    return mEntries.size();
+}
@@ -0,0 +1,119 @@
+/* -*- C++ -*-
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+//---------------------------------------------------------------------------
+//---------------------------------------------------------------------------
+#ifndef headercacheH
+#define headercacheH
+//---------------------------------------------------------------------------
+
+#include "config.h"
+
+#include <atomic>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace simplecpp {
+    class TokenList;
+    struct Output;
+}
+
+/// @addtogroup Core
+/// @{
+
+/**
+ * @brief Cache of the raw tokens of included files.
+ *
+ * The cache is shared by all CppCheck instances of an analysis so a header
+ * which is included by several translation units is only read and tokenized
+ * once. The cached data is immutable and the entries are validated against
+ * the modification time and size of the file. When the memory used by the
+ * cache exceeds the limit the least recently used entries are evicted.
+ *
+ * The file indexes of simplecpp tokens refer to the filenames of a translation
+ * unit so each unit is given a copy of the cached tokens.
+ */
+class CPPCHECKLIB HeaderCache {
+public:
+    /**
+     * @param maxSize the maximum memory (in bytes) used by the cached data
+     */
+    explicit HeaderCache(std::size_t maxSize);
+    ~HeaderCache();
+
+    HeaderCache(const HeaderCache &) = delete;
+    HeaderCache& operator=(const HeaderCache &) = delete;
+
+    /**
+     * @brief Get the raw tokens of a file.
+     * The file is read if it is not cached or if it has been modified.
+     * This can be used as simplecpp::FileDataCache::read_callback_type.
+     * @param path the file to read
+     * @param filenames the filenames of the translation unit
+     * @param outputList the messages from reading the file are added to this
+     * @return the tokens of the file
+     */
+    simplecpp::TokenList read(const std::string &path, std::vector<std::string> &filenames, std::list<simplecpp::Output> *outputList);
+
+    /** remove all entries */
+    void clear();
+
+    std::size_t maxSize() const {
+        return mMaxSize;
+    }
+
+    /** the estimated memory (in bytes) used by the cached data */
+    std::size_t size() const;
+
+    /** number of cached files */
+    std::size_t count() const;
+
+    /** number of reads which used the cached data */
+    std::size_t hits() const {
+        return mHits;
+    }
+
+    /** number of reads which had to read the file */
+    std::size_t misses() const {
+        return mMisses;
+    }
+
+private:
+    struct Entry;
+
+    void insert(const std::string &path, std::shared_ptr<const Entry> entry);
+
+    const std::size_t mMaxSize;
+
+    mutable std::mutex mSync;
+    /** least recently used entries first */
+    std::list<std::string> mLru;
+    std::unordered_map<std::string, std::pair<std::shared_ptr<const Entry>, std::list<std::string>::iterator>> mEntries;
+    std::size_t mSize{};
+
+    std::atomic<std::size_t> mHits{};
+    std::atomic<std::size_t> mMisses{};
+};
+
+/// @}
+//---------------------------------------------------------------------------
+#endif // headercacheH
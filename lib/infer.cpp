@@ -27,12 +27,11 @@
 #include <cassert>
 #include <algorithm>
 #include <functional>
-#include <iterator>
 #include <unordered_set>
 #include <utility>
 
 template<class Predicate, class Compare>
-static const ValueFlow::Value* getCompareValue(const std::list<ValueFlow::Value>& values, Predicate pred, Compare compare)
+static const ValueFlow::Value* getCompareValue(const std::vector<ValueFlow::Value>& values, Predicate pred, Compare compare)
 {
     const ValueFlow::Value* result = nullptr;
     for (const ValueFlow::Value& value : values) {
@@ -122,7 +121,7 @@ namespace {
         }
 
         template<class Predicate>
-        static Interval fromValues(const std::list<ValueFlow::Value>& values, Predicate predicate)
+        static Interval fromValues(const std::vector<ValueFlow::Value>& values, Predicate predicate)
         {
             Interval result;
             const ValueFlow::Value* minValue = getCompareValue(values, predicate, std::less<MathLib::bigint>{});
@@ -146,7 +145,7 @@ namespace {
             return result;
         }
 
-        static Interval fromValues(const std::list<ValueFlow::Value>& values)
+        static Interval fromValues(const std::vector<ValueFlow::Value>& values)
         {
             return Interval::fromValues(values, [](const ValueFlow::Value&) {
                 return true;
@@ -243,18 +242,14 @@ static void addToErrorPath(ValueFlow::Value& value, const std::vector<const Valu
     for (const ValueFlow::Value* ref : refs) {
         if (ref->condition && !value.condition)
             value.condition = ref->condition;
-        std::copy_if(ref->errorPath.cbegin(),
-                     ref->errorPath.cend(),
-                     std::back_inserter(value.errorPath),
-                     [&](const ErrorPathItem& e) {
-            return locations.insert(e.first).second;
-        });
-        std::copy_if(ref->debugPath.cbegin(),
-                     ref->debugPath.cend(),
-                     std::back_inserter(value.debugPath),
-                     [&](const ErrorPathItem& e) {
-            return locations.insert(e.first).second;
+        ref->errorPath.forEach([&](const Token* tok, const std::string& info) {
+            if (locations.insert(tok).second)
+                value.errorPath.emplace_back(tok, info);
         });
+        for (const ErrorPathItem& e : ref->debugPath()) {
+            if (locations.insert(e.first).second)
+                value.addDebugPath(e);
+        }
     }
 }
 
@@ -276,7 +271,7 @@ static void setValueKind(ValueFlow::Value& value, const std::vector<const ValueF
         value.setKnown();
 }
 
-static bool inferNotEqual(const std::list<ValueFlow::Value>& values, MathLib::bigint x)
+static bool inferNotEqual(const std::vector<ValueFlow::Value>& values, MathLib::bigint x)
 {
     return std::any_of(values.cbegin(), values.cend(), [&](const ValueFlow::Value& value) {
         return value.isImpossible() && value.intvalue == x;
@@ -285,17 +280,17 @@ static bool inferNotEqual(const std::list<ValueFlow::Value>& values, MathLib::bi
 
 std::vector<ValueFlow::Value> infer(const ValuePtr<InferModel>& model,
                                     const std::string& op,
-                                    std::list<ValueFlow::Value> lhsValues,
-                                    std::list<ValueFlow::Value> rhsValues)
+                                    std::vector<ValueFlow::Value> lhsValues,
+                                    std::vector<ValueFlow::Value> rhsValues)
 {
     std::vector<ValueFlow::Value> result;
     auto notMatch = [&](const ValueFlow::Value& value) {
         return !model->match(value);
     };
-    lhsValues.remove_if(notMatch);
+    lhsValues.erase(std::remove_if(lhsValues.begin(), lhsValues.end(), notMatch), lhsValues.end());
     if (lhsValues.empty())
         return result;
-    rhsValues.remove_if(notMatch);
+    rhsValues.erase(std::remove_if(rhsValues.begin(), rhsValues.end(), notMatch), rhsValues.end());
     if (rhsValues.empty())
         return result;
 
@@ -363,26 +358,26 @@ std::vector<ValueFlow::Value> infer(const ValuePtr<InferModel>& model,
 std::vector<ValueFlow::Value> infer(const ValuePtr<InferModel>& model,
                                     const std::string& op,
                                     MathLib::bigint lhs,
-                                    std::list<ValueFlow::Value> rhsValues)
+                                    std::vector<ValueFlow::Value> rhsValues)
 {
     return infer(model, op, {model->yield(lhs)}, std::move(rhsValues));
 }
 
 std::vector<ValueFlow::Value> infer(const ValuePtr<InferModel>& model,
                                     const std::string& op,
-                                    std::list<ValueFlow::Value> lhsValues,
+                                    std::vector<ValueFlow::Value> lhsValues,
                                     MathLib::bigint rhs)
 {
     return infer(model, op, std::move(lhsValues), {model->yield(rhs)});
 }
 
-std::vector<MathLib::bigint> getMinValue(const ValuePtr<InferModel>& model, const std::list<ValueFlow::Value>& values)
+std::vector<MathLib::bigint> getMinValue(const ValuePtr<InferModel>& model, const std::vector<ValueFlow::Value>& values)
 {
     return Interval::fromValues(values, [&](const ValueFlow::Value& v) {
         return model->match(v);
     }).minvalue;
 }
-std::vector<MathLib::bigint> getMaxValue(const ValuePtr<InferModel>& model, const std::list<ValueFlow::Value>& values)
+std::vector<MathLib::bigint> getMaxValue(const ValuePtr<InferModel>& model, const std::vector<ValueFlow::Value>& values)
 {
     return Interval::fromValues(values, [&](const ValueFlow::Value& v) {
         return model->match(v);
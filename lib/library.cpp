@@ -1206,7 +1206,7 @@ std::string Library::getFunctionName(const Token *ftok, bool &error) const
 
 std::string Library::getFunctionName(const Token *ftok) const
 {
-    if (!Token::Match(ftok, "%name% )| (") && (ftok->strAt(-1) != "&" || ftok->previous()->astOperand2()))
+    if (!Token::Match(ftok, MATCH_PATTERN("%name% )| (")) && (ftok->strAt(-1) != "&" || ftok->previous()->astOperand2()))
         return "";
 
     // Lookup function name using AST..
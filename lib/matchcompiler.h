@@ -20,10 +20,170 @@
 #ifndef matchcompilerH
 #define matchcompilerH
 
+#include "config.h"
+
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
+class Token;
+
+/**
+ * Compile a Token::Match() pattern at compile time.
+ *
+ * Token::Match(tok, MATCH_PATTERN("%name% (")) parses the pattern when the
+ * calling code is compiled and matches the tokens with code specialized for
+ * each word of the pattern. Patterns which are not supported (empty
+ * alternatives which are not the last one, unknown %%cmd%) are compile errors.
+ * The behavior is the same as the runtime interpretation of the pattern.
+ */
+#define MATCH_PATTERN(pattern) \
+    ([]() { \
+        struct CompiledPattern : MatchCompiler::Pattern { \
+            static constexpr const char* str() { \
+                return pattern; \
+            } \
+        }; \
+        return CompiledPattern{}; \
+    }())
+
 namespace MatchCompiler {
 
+    /** Base of the types created by MATCH_PATTERN */
+    struct Pattern {};
+
+    enum class Kind : std::uint8_t {
+        // alternatives of a word
+        literal, any, assign, boolean, character, comp, cop, name, num, op, orOp, ororOp, str, type, var, varid,
+        // words
+        alternatives, chars, notLiteral
+    };
+
+    /** a word of a pattern: "int|%name%|", "[;{}]" or "!!else" */
+    struct Word {
+        Kind kind;
+        std::size_t alternatives;
+        /** the word ends with "|" and matches no token if no alternative matches */
+        bool optional;
+    };
+
+    /**
+     * an alternative of a word. The text of the characters of a "[;{}]" word
+     * and of the operand of a "!!else" word is stored as one literal alternative.
+     */
+    struct Alternative {
+        Kind kind;
+        std::size_t begin;
+        std::size_t end;
+    };
+
+    /** reports an invalid pattern, this is not a constant expression so it fails the compilation */
+    inline Kind invalidPattern() {
+        return Kind::literal;
+    }
+
+    constexpr bool isWordEnd(char c) {
+        return c == ' ' || c == '\0';
+    }
+
+    constexpr std::size_t skipSpaces(const char* s, std::size_t pos) {
+        return s[pos] == ' ' ? skipSpaces(s, pos + 1) : pos;
+    }
+
+    constexpr std::size_t wordEnd(const char* s, std::size_t pos) {
+        return isWordEnd(s[pos]) ? pos : wordEnd(s, pos + 1);
+    }
+
+    constexpr std::size_t countWords(const char* s, std::size_t pos = 0) {
+        return s[skipSpaces(s, pos)] == '\0' ? 0 : 1 + countWords(s, wordEnd(s, skipSpaces(s, pos)));
+    }
+
+    constexpr std::size_t wordBegin(const char* s, std::size_t nr, std::size_t pos = 0) {
+        return nr == 0 ? skipSpaces(s, pos) : wordBegin(s, nr - 1, wordEnd(s, skipSpaces(s, pos)));
+    }
+
+    constexpr std::size_t count(const char* s, std::size_t begin, std::size_t end, char c) {
+        return begin == end ? 0 : (s[begin] == c ? 1 : 0) + count(s, begin + 1, end, c);
+    }
+
+    constexpr bool equals(const char* s, std::size_t begin, std::size_t end, const char* str) {
+        return begin == end ? *str == '\0' : (*str == s[begin] && equals(s, begin + 1, end, str + 1));
+    }
+
+    /** the alternatives of a word are separated by "|", only the last one may be empty */
+    constexpr bool hasEmptyAlternative(const char* s, std::size_t begin, std::size_t end) {
+        return begin + 1 < end && ((s[begin] == '|' && s[begin + 1] == '|') || hasEmptyAlternative(s, begin + 1, end));
+    }
+
+    constexpr Kind wordKind(const char* s, std::size_t begin, std::size_t end) {
+        return (s[begin] == '[' && count(s, begin, end, ']') > 0) ? Kind::chars :
+               (s[begin] == '!' && s[begin + 1] == '!') ? (end - begin > 2 ? Kind::notLiteral : invalidPattern()) :
+               (s[begin] == '|' || hasEmptyAlternative(s, begin, end)) ? invalidPattern() :
+               Kind::alternatives;
+    }
+
+    constexpr bool isOptional(const char* s, std::size_t begin, std::size_t end) {
+        return wordKind(s, begin, end) == Kind::alternatives && s[end - 1] == '|';
+    }
+
+    constexpr std::size_t wordAlternatives(const char* s, std::size_t begin, std::size_t end) {
+        return wordKind(s, begin, end) != Kind::alternatives ? 1 :
+               count(s, begin, end, '|') + (isOptional(s, begin, end) ? 0 : 1);
+    }
+
+    constexpr Kind commandKind(const char* s, std::size_t begin, std::size_t end) {
+        return equals(s, begin, end, "any%") ? Kind::any :
+               equals(s, begin, end, "assign%") ? Kind::assign :
+               equals(s, begin, end, "bool%") ? Kind::boolean :
+               equals(s, begin, end, "char%") ? Kind::character :
+               equals(s, begin, end, "comp%") ? Kind::comp :
+               equals(s, begin, end, "cop%") ? Kind::cop :
+               equals(s, begin, end, "name%") ? Kind::name :
+               equals(s, begin, end, "num%") ? Kind::num :
+               equals(s, begin, end, "op%") ? Kind::op :
+               equals(s, begin, end, "or%") ? Kind::orOp :
+               equals(s, begin, end, "oror%") ? Kind::ororOp :
+               equals(s, begin, end, "str%") ? Kind::str :
+               equals(s, begin, end, "type%") ? Kind::type :
+               equals(s, begin, end, "var%") ? Kind::var :
+               equals(s, begin, end, "varid%") ? Kind::varid :
+               invalidPattern();
+    }
+
+    /** "%" and "%=" are literals */
+    constexpr Kind alternativeKind(const char* s, std::size_t begin, std::size_t end) {
+        return (s[begin] == '%' && end - begin > 1 && s[begin + 1] != '=') ? commandKind(s, begin + 1, end) : Kind::literal;
+    }
+
+    constexpr std::size_t alternativeEnd(const char* s, std::size_t pos) {
+        return (s[pos] == '|' || isWordEnd(s[pos])) ? pos : alternativeEnd(s, pos + 1);
+    }
+
+    constexpr std::size_t alternativeBegin(const char* s, std::size_t pos, std::size_t nr) {
+        return nr == 0 ? pos : alternativeBegin(s, alternativeEnd(s, pos) + 1, nr - 1);
+    }
+
+    constexpr Word makeWord(const char* s, std::size_t begin, std::size_t end) {
+        return Word{wordKind(s, begin, end), wordAlternatives(s, begin, end), isOptional(s, begin, end)};
+    }
+
+    /** the word with the given index */
+    constexpr Word makeWord(const char* s, std::size_t nr) {
+        return makeWord(s, wordBegin(s, nr), wordEnd(s, wordBegin(s, nr)));
+    }
+
+    /** the alternative with the given index in the word which starts at begin */
+    constexpr Alternative makeAlternative(const char* s, std::size_t begin, std::size_t nr) {
+        return wordKind(s, begin, wordEnd(s, begin)) == Kind::chars ? Alternative{Kind::literal, begin + 1, wordEnd(s, begin)} :
+               wordKind(s, begin, wordEnd(s, begin)) == Kind::notLiteral ? Alternative{Kind::literal, begin + 2, wordEnd(s, begin)} :
+               Alternative{alternativeKind(s, alternativeBegin(s, begin, nr), alternativeEnd(s, alternativeBegin(s, begin, nr))),
+                           alternativeBegin(s, begin, nr),
+                           alternativeEnd(s, alternativeBegin(s, begin, nr))};
+    }
+
+    template<class P>
+    bool match(const Token* tok, nonneg int varid);
+
     template<unsigned int n>
     class ConstString {
     public:
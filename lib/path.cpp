@@ -452,6 +452,16 @@ bool Path::isDirectory(const std::string &path)
     return file_type(path) == S_IFDIR;
 }
 
+std::size_t Path::fileSize(const std::string &path)
+{
+    struct stat file_stat;
+    if (stat(path.c_str(), &file_stat) == -1)
+        return 0;
+    if ((file_stat.st_mode & S_IFMT) != S_IFREG)
+        return 0;
+    return file_stat.st_size;
+}
+
 bool Path::exists(const std::string &path, bool* isdir)
 {
     const auto type = file_type(path);
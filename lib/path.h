@@ -24,6 +24,7 @@
 #include "config.h"
 #include "standards.h"
 
+#include <cstddef>
 #include <set>
 #include <string>
 #include <vector>
@@ -207,6 +208,13 @@ public:
      */
     static bool exists(const std::string &path, bool* isdir = nullptr);
 
+    /**
+     * @brief Get the size of a file
+     * @param path Path to the file
+     * @return the size of the file in bytes - 0 if it does not exist
+     */
+    static std::size_t fileSize(const std::string &path);
+
     /**
      * @brief join 2 paths with '/' separators
      * if path2 is an absolute path path1 will be dismissed.
@@ -1110,6 +1110,14 @@ std::size_t Preprocessor::calculateHash(const std::string &toolinfo) const
     return (std::hash<std::string>{})(hashData);
 }
 
+void Preprocessor::getIncludedFiles(std::set<std::string> &files, std::set<std::string> &missing) const
+{
+    for (const auto &filedata : mFileCache)
+        files.insert(filedata->filename);
+    for (std::string &path : mFileCache.missing())
+        missing.insert(std::move(path));
+}
+
 void Preprocessor::simplifyPragmaAsm()
 {
     simplifyPragmaAsm(mTokens);
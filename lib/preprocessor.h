@@ -163,6 +163,17 @@ public:
         mFileCache.set_load_callback(std::move(cb));
     }
 
+    void setReadCallback(simplecpp::FileDataCache::read_callback_type cb) {
+        mFileCache.set_read_callback(std::move(cb));
+    }
+
+    /**
+     * Get the files which have been included so far.
+     * @param files the loaded files
+     * @param missing the paths which have been looked up but do not exist
+     */
+    void getIncludedFiles(std::set<std::string> &files, std::set<std::string> &missing) const;
+
 private:
 
     /**
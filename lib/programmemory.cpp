@@ -63,12 +63,185 @@ std::size_t ExprIdToken::Hash::operator()(ExprIdToken etok) const
     return std::hash<nonneg int>()(etok.getExpressionId());
 }
 
+static int popcount(std::uint32_t x)
+{
+    int n = 0;
+    for (; x; x &= x - 1)
+        ++n;
+    return n;
+}
+
+ExprIdMap::const_iterator::const_iterator(const Node* root, int levels)
+    : mLevels(levels)
+{
+    if (root)
+        first(root, 0);
+}
+
+void ExprIdMap::const_iterator::first(const Node* node, int level)
+{
+    for (; level < mLevels - 1; ++level) {
+        mPath[level] = {node, 0};
+        node = node->children.front().get();
+    }
+    mPath[level] = {node, 0};
+    mEntry = node->entries.front().get();
+}
+
+ExprIdMap::const_iterator& ExprIdMap::const_iterator::operator++()
+{
+    int level = mLevels - 1;
+    Position* pos = &mPath[level];
+    if (++pos->index < pos->node->entries.size()) {
+        mEntry = pos->node->entries[pos->index].get();
+        return *this;
+    }
+    while (level > 0) {
+        --level;
+        pos = &mPath[level];
+        if (++pos->index < pos->node->children.size()) {
+            first(pos->node->children[pos->index].get(), level + 1);
+            return *this;
+        }
+    }
+    mEntry = nullptr;
+    return *this;
+}
+
+// the shared nodes and entries are copied before they are modified
+template<class T>
+static T* unshare(std::shared_ptr<T>& p)
+{
+    if (p.use_count() != 1)
+        p = std::make_shared<T>(*p);
+    return p.get();
+}
+
+const ExprIdMap::value_type* ExprIdMap::find(nonneg int exprid) const
+{
+    if (!mRoot || (static_cast<std::uint32_t>(exprid) >> mShift >> bits) != 0)
+        return nullptr;
+    const Node* node = mRoot.get();
+    for (int shift = mShift;; shift -= bits) {
+        const std::uint32_t bit = 1U << ((static_cast<std::uint32_t>(exprid) >> shift) & 31);
+        if ((node->bitmap & bit) == 0)
+            return nullptr;
+        const int index = popcount(node->bitmap & (bit - 1));
+        if (shift == 0)
+            return node->entries[index].get();
+        node = node->children[index].get();
+    }
+}
+
+ExprIdMap::value_type* ExprIdMap::findMutable(nonneg int exprid)
+{
+    if (!find(exprid))
+        return nullptr;
+    Node* node = unshare(mRoot);
+    for (int shift = mShift;; shift -= bits) {
+        const std::uint32_t bit = 1U << ((static_cast<std::uint32_t>(exprid) >> shift) & 31);
+        const int index = popcount(node->bitmap & (bit - 1));
+        if (shift == 0)
+            return unshare(node->entries[index]);
+        node = unshare(node->children[index]);
+    }
+}
+
+ValueFlow::Value& ExprIdMap::operator[](const ExprIdToken& key)
+{
+    const auto exprid = static_cast<std::uint32_t>(key.getExpressionId());
+    if (!mRoot)
+        mRoot = std::make_shared<Node>();
+    // add levels above the root until the expression id fits
+    while ((exprid >> mShift >> bits) != 0) {
+        if (mRoot->bitmap != 0) {
+            auto root = std::make_shared<Node>();
+            root->bitmap = 1;
+            root->children.push_back(std::move(mRoot));
+            mRoot = std::move(root);
+        }
+        mShift += bits;
+    }
+    Node* node = unshare(mRoot);
+    for (int shift = mShift;; shift -= bits) {
+        const std::uint32_t bit = 1U << ((exprid >> shift) & 31);
+        const int index = popcount(node->bitmap & (bit - 1));
+        const bool found = (node->bitmap & bit) != 0;
+        node->bitmap |= bit;
+        if (shift == 0) {
+            if (!found) {
+                node->entries.insert(node->entries.begin() + index, std::make_shared<value_type>(key, ValueFlow::Value()));
+                ++mSize;
+            }
+            return unshare(node->entries[index])->second;
+        }
+        if (!found)
+            node->children.insert(node->children.begin() + index, std::make_shared<Node>());
+        node = unshare(node->children[index]);
+    }
+}
+
+void ExprIdMap::erase(nonneg int exprid)
+{
+    if (!find(exprid))
+        return;
+    std::array<Node*, maxLevels> path{};
+    Node* node = unshare(mRoot);
+    int level = 0;
+    for (int shift = mShift;; shift -= bits) {
+        path[level] = node;
+        const std::uint32_t bit = 1U << ((static_cast<std::uint32_t>(exprid) >> shift) & 31);
+        const int index = popcount(node->bitmap & (bit - 1));
+        if (shift == 0)
+            break;
+        node = unshare(node->children[index]);
+        ++level;
+    }
+    --mSize;
+    // remove the entry and the nodes which become empty
+    for (int shift = 0; level >= 0; shift += bits, --level) {
+        node = path[level];
+        const std::uint32_t bit = 1U << ((static_cast<std::uint32_t>(exprid) >> shift) & 31);
+        const int index = popcount(node->bitmap & (bit - 1));
+        if (shift == 0)
+            node->entries.erase(node->entries.begin() + index);
+        else
+            node->children.erase(node->children.begin() + index);
+        node->bitmap &= ~bit;
+        if (node->bitmap != 0)
+            return;
+    }
+    clear();
+}
+
+void ExprIdMap::erase_if(const std::function<bool(const ExprIdToken&)>& pred)
+{
+    std::vector<nonneg int> erased;
+    for (const value_type& p : *this) {
+        if (pred(p.first))
+            erased.push_back(p.first.getExpressionId());
+    }
+    for (const nonneg int exprid : erased)
+        erase(exprid);
+}
+
+void ExprIdMap::clear()
+{
+    mRoot.reset();
+    mShift = 0;
+    mSize = 0;
+}
+
+ProgramMemory::ProgramMemory(const Map& values)
+{
+    for (const auto& p : values)
+        mValues[p.first] = p.second;
+}
+
 void ProgramMemory::setValue(const Token* expr, const ValueFlow::Value& value) {
     if (!expr)
         return;
 
-    copyOnWrite();
-
     ValueFlow::Value subvalue = value;
     const Token* subexpr = solveExprValue(
         expr,
@@ -82,17 +255,17 @@ void ProgramMemory::setValue(const Token* expr, const ValueFlow::Value& value) {
     },
         subvalue);
     if (expr != subexpr)
-        (*mValues)[expr] = value;
+        mValues[expr] = value;
     if (subexpr)
-        (*mValues)[subexpr] = std::move(subvalue);
+        mValues[subexpr] = std::move(subvalue);
 }
 
 const ValueFlow::Value* ProgramMemory::getValue(nonneg int exprid, bool impossible) const
 {
-    const auto it = find(exprid);
-    const bool found = it != mValues->cend() && (impossible || !it->second.isImpossible());
+    const ExprIdMap::value_type* p = mValues.find(exprid);
+    const bool found = p && (impossible || !p->second.isImpossible());
     if (found)
-        return &it->second;
+        return &p->second;
     return nullptr;
 }
 
@@ -160,69 +333,48 @@ void ProgramMemory::setContainerSizeValue(const Token* expr, MathLib::bigint val
 }
 
 void ProgramMemory::setUnknown(const Token* expr) {
-    copyOnWrite();
-
-    (*mValues)[expr].valueType = ValueFlow::Value::ValueType::UNINIT;
+    mValues[expr].valueType = ValueFlow::Value::ValueType::UNINIT;
 }
 
 bool ProgramMemory::hasValue(nonneg int exprid) const
 {
-    const auto it = find(exprid);
-    return it != mValues->cend();
+    return mValues.find(exprid) != nullptr;
 }
 
 const ValueFlow::Value& ProgramMemory::at(nonneg int exprid) const {
-    const auto it = find(exprid);
-    if (it == mValues->cend()) {
+    const ExprIdMap::value_type* p = mValues.find(exprid);
+    if (!p) {
         throw std::out_of_range("ProgramMemory::at");
     }
-    return it->second;
+    return p->second;
 }
 
 ValueFlow::Value& ProgramMemory::at(nonneg int exprid) {
-    copyOnWrite();
-
-    const auto it = find(exprid);
-    if (it == mValues->end()) {
+    ExprIdMap::value_type* p = mValues.findMutable(exprid);
+    if (!p) {
         throw std::out_of_range("ProgramMemory::at");
     }
-    return it->second;
+    return p->second;
 }
 
 void ProgramMemory::erase_if(const std::function<bool(const ExprIdToken&)>& pred)
 {
-    if (mValues->empty())
-        return;
-
-    // TODO: how to delay until we actually modify?
-    copyOnWrite();
-
-    for (auto it = mValues->begin(); it != mValues->end();) {
-        if (pred(it->first))
-            it = mValues->erase(it);
-        else
-            ++it;
-    }
+    mValues.erase_if(pred);
 }
 
 void ProgramMemory::swap(ProgramMemory &pm) noexcept
 {
-    mValues.swap(pm.mValues);
+    std::swap(mValues, pm.mValues);
 }
 
 void ProgramMemory::clear()
 {
-    if (mValues->empty())
-        return;
-
-    copyOnWrite();
-
-    mValues->clear();
+    mValues.clear();
 }
 
 bool ProgramMemory::empty() const
 {
-    return mValues->empty();
+    return mValues.empty();
 }
 
 // NOLINTNEXTLINE(performance-unnecessary-value-param) - technically correct but we are moving the given values
@@ -231,37 +383,21 @@ void ProgramMemory::replace(ProgramMemory pm, bool skipUnknown)
     if (pm.empty())
         return;
 
-    copyOnWrite();
+    if (empty()) {
+        mValues = std::move(pm.mValues);
+        return;
+    }
 
-    for (auto&& p : (*pm.mValues)) {
+    for (const ExprIdMap::value_type& p : pm.mValues) {
         if (skipUnknown) {
-            auto it = mValues->find(p.first);
-            if (it != mValues->end() && it->second.isUninitValue())
+            const ExprIdMap::value_type* old = mValues.find(p.first.getExpressionId());
+            if (old && old->second.isUninitValue())
                 continue;
         }
-        (*mValues)[p.first] = std::move(p.second);
+        mValues[p.first] = p.second;
     }
 }
 
-void ProgramMemory::copyOnWrite()
-{
-    if (mValues.use_count() == 1)
-        return;
-
-    mValues = std::make_shared<Map>(*mValues);
-}
-
-ProgramMemory::Map::const_iterator ProgramMemory::find(nonneg int exprid) const
-{
-    const auto& cvalues = utils::as_const(*mValues);
-    return cvalues.find(ExprIdToken::create(exprid));
-}
-
-ProgramMemory::Map::iterator ProgramMemory::find(nonneg int exprid)
-{
-    return mValues->find(ExprIdToken::create(exprid));
-}
-
 static ValueFlow::Value execute(const Token* expr,
                                 ProgramMemory& pm,
                                 const Settings& settings,
@@ -451,7 +587,7 @@ static void fillProgramMemoryFromAssignments(ProgramMemory& pm, const Token* tok
 {
     int indentlevel = 0;
     for (const Token *tok2 = tok; tok2; tok2 = tok2->previous()) {
-        if ((Token::simpleMatch(tok2, "=") || Token::Match(tok2->previous(), "%var% (|{")) && tok2->astOperand1() &&
+        if ((Token::simpleMatch(tok2, "=") || Token::Match(tok2->previous(), MATCH_PATTERN("%var% (|{"))) && tok2->astOperand1() &&
             tok2->astOperand2()) {
             const Token* vartok = tok2->astOperand1();
             if (!pm.hasValue(vartok->exprId())) {
@@ -470,7 +606,7 @@ static void fillProgramMemoryFromAssignments(ProgramMemory& pm, const Token* tok
                 programMemoryParseCondition(pm, cond, nullptr, settings, true);
             }
             tok2 = tok2->link()->previous();
-        } else if (tok2->exprId() > 0 && Token::Match(tok2, ".|(|[|*|%var%") && !pm.hasValue(tok2->exprId()) &&
+        } else if (tok2->exprId() > 0 && Token::Match(tok2, MATCH_PATTERN(".|(|[|*|%var%")) && !pm.hasValue(tok2->exprId()) &&
                    isVariableChanged(tok2, 0, settings)) {
             pm.setUnknown(tok2);
         }
@@ -1536,7 +1672,7 @@ namespace {
             }
             if (expr->isBoolean())
                 return ValueFlow::Value{expr->str() == "true"};
-            if (Token::Match(expr->tokAt(-2), ". %name% (") && astIsContainer(expr->tokAt(-2)->astOperand1())) {
+            if (Token::Match(expr->tokAt(-2), MATCH_PATTERN(". %name% (")) && astIsContainer(expr->tokAt(-2)->astOperand1())) {
                 const Token* containerTok = expr->tokAt(-2)->astOperand1();
                 const Library::Container::Yield yield = containerTok->valueType()->container->getYield(expr->strAt(-1));
                 if (yield == Library::Container::Yield::SIZE) {
@@ -1621,7 +1757,7 @@ namespace {
                     return ValueFlow::Value{strValue[index]};
                 if (index == strValue.size())
                     return ValueFlow::Value{};
-            } else if (Token::Match(expr, "%cop%") && expr->astOperand1() && expr->astOperand2()) {
+            } else if (Token::Match(expr, MATCH_PATTERN("%cop%")) && expr->astOperand1() && expr->astOperand2()) {
                 ValueFlow::Value lhs = execute(expr->astOperand1());
                 if (lhs.isUninitValue())
                     return unknown();
@@ -1651,7 +1787,7 @@ namespace {
                 return r;
             }
             // Unary ops
-            else if (Token::Match(expr, "!|+|-") && expr->astOperand1() && !expr->astOperand2()) {
+            else if (Token::Match(expr, MATCH_PATTERN("!|+|-")) && expr->astOperand1() && !expr->astOperand2()) {
                 ValueFlow::Value lhs = execute(expr->astOperand1());
                 if (!lhs.isIntValue())
                     return unknown();
@@ -1705,7 +1841,7 @@ namespace {
                 return result;
             }
 
-            if (Token::Match(expr->previous(), ">|%name% {|(")) {
+            if (Token::Match(expr->previous(), MATCH_PATTERN(">|%name% {|("))) {
                 const Token* ftok = expr->previous();
                 const Function* f = ftok->function();
                 ValueFlow::Value result = unknown();
@@ -23,8 +23,11 @@
 #include "mathlib.h"
 #include "vfvalue.h" // needed for alias
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <string>
@@ -102,12 +105,136 @@ private:
     explicit ExprIdToken(nonneg int exprId);
 };
 
+/**
+ * Persistent map from expression ids to values. Copies share their nodes and
+ * a modification only copies the shared nodes on the path to the modified
+ * entry, so copying is O(1) and modifying is O(log n). The entries are stored
+ * in a trie which uses 5 bits of the expression id per level, from the most
+ * significant to the least significant bits, so the entries are iterated in
+ * the order of their expression ids.
+ */
+class CPPCHECKLIB ExprIdMap {
+public:
+    using value_type = std::pair<const ExprIdToken, ValueFlow::Value>;
+
+private:
+    static constexpr int bits = 5;
+    static constexpr int maxLevels = 7;
+
+    struct Node {
+        std::uint32_t bitmap{};
+        /** The child nodes, above the last level */
+        std::vector<std::shared_ptr<Node>> children;
+        /** The entries, on the last level */
+        std::vector<std::shared_ptr<value_type>> entries;
+    };
+
+public:
+    class CPPCHECKLIB const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = ExprIdMap::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+
+        const_iterator() = default;
+
+        reference operator*() const {
+            return *mEntry;
+        }
+
+        pointer operator->() const {
+            return mEntry;
+        }
+
+        const_iterator& operator++();
+
+        const_iterator operator++(int) {
+            const_iterator it = *this;
+            ++(*this);
+            return it;
+        }
+
+        bool operator==(const const_iterator& rhs) const {
+            return mEntry == rhs.mEntry;
+        }
+
+        bool operator!=(const const_iterator& rhs) const {
+            return mEntry != rhs.mEntry;
+        }
+
+    private:
+        friend class ExprIdMap;
+
+        const_iterator(const Node* root, int levels);
+
+        /** Go to the first entry below the node of the given level */
+        void first(const Node* node, int level);
+
+        struct Position {
+            const Node* node;
+            std::size_t index;
+        };
+        std::array<Position, maxLevels> mPath{};
+        int mLevels{};
+        const value_type* mEntry{};
+    };
+
+    ExprIdMap() = default;
+
+    std::size_t size() const {
+        return mSize;
+    }
+
+    bool empty() const {
+        return mSize == 0;
+    }
+
+    const value_type* find(nonneg int exprid) const;
+
+    /** Find an entry to modify, the shared nodes on the path to it are copied */
+    value_type* findMutable(nonneg int exprid);
+
+    /** Find or insert the entry of the key, the shared nodes on the path to it are copied */
+    ValueFlow::Value& operator[](const ExprIdToken& key);
+
+    void erase_if(const std::function<bool(const ExprIdToken&)>& pred);
+
+    void clear();
+
+    const_iterator begin() const {
+        return const_iterator(mRoot.get(), levels());
+    }
+
+    const_iterator end() const {
+        return const_iterator();
+    }
+
+    /** Are the maps the same object or unmodified copies of each other? */
+    bool sameData(const ExprIdMap& other) const {
+        return mRoot == other.mRoot;
+    }
+
+private:
+    int levels() const {
+        return mShift / bits + 1;
+    }
+
+    void erase(nonneg int exprid);
+
+    std::shared_ptr<Node> mRoot;
+    /** The shift of the expression id for the root level */
+    int mShift{};
+    std::size_t mSize{};
+};
+
 struct CPPCHECKLIB ProgramMemory {
     using Map = std::map<ExprIdToken, ValueFlow::Value>;
 
-    ProgramMemory() : mValues(new Map()) {}
+    ProgramMemory() = default;
 
-    explicit ProgramMemory(Map values) : mValues(new Map(std::move(values))) {}
+    explicit ProgramMemory(const Map& values);
 
     void setValue(const Token* expr, const ValueFlow::Value& value);
     const ValueFlow::Value* getValue(nonneg int exprid, bool impossible = false) const;
@@ -137,28 +264,24 @@ struct CPPCHECKLIB ProgramMemory {
 
     void replace(ProgramMemory pm, bool skipUnknown = false);
 
-    Map::const_iterator begin() const {
-        return mValues->cbegin();
+    ExprIdMap::const_iterator begin() const {
+        return mValues.begin();
     }
 
-    Map::const_iterator end() const {
-        return mValues->cend();
+    ExprIdMap::const_iterator end() const {
+        return mValues.end();
     }
 
     friend bool operator==(const ProgramMemory& x, const ProgramMemory& y) {
-        return x.mValues == y.mValues;
+        return x.mValues.sameData(y.mValues);
     }
 
     friend bool operator!=(const ProgramMemory& x, const ProgramMemory& y) {
-        return x.mValues != y.mValues;
+        return !x.mValues.sameData(y.mValues);
     }
 
 private:
-    void copyOnWrite();
-    Map::const_iterator find(nonneg int exprid) const;
-    Map::iterator find(nonneg int exprid);
-
-    std::shared_ptr<Map> mValues;
+    ExprIdMap mValues;
 };
 
 struct ProgramMemoryState {
@@ -151,6 +151,14 @@ public:
     /** @brief --cppcheck-build-dir. Always uses / as path separator. No trailing path separator. */
     std::string buildDir;
 
+    enum class BuildDirFormat : std::uint8_t {
+        XML,
+        BINARY
+    };
+
+    /** @brief format of the analyzer information in the build dir (--cppcheck-build-dir-format=xml|binary) */
+    BuildDirFormat buildDirFormat{};
+
     /** Is the 'configuration checking' wanted? */
     bool checkConfiguration{};
 
@@ -192,6 +200,10 @@ public:
     /** @brief include paths excluded from checking the configuration */
     std::set<std::string> configExcludePaths;
 
+    /** @brief How many configurations of a single file should be checked at the
+        same time. Default is 1. (--config-jobs=N) */
+    unsigned int configJobs = 1;
+
     /** cppcheck.cfg: Custom product name */
     std::string cppcheckCfgProductName;
 
@@ -294,6 +306,10 @@ public:
         for finding include files inside source files. (-I) */
     std::list<std::string> includePaths;
 
+    /** @brief Maximum memory (in MiB) used to cache the tokens of included files.
+        0 disables the cache. Default is 256. (--header-cache-size=N) */
+    unsigned int headerCacheSize = 256;
+
     /** @brief Is --inline-suppr given? */
     bool inlineSuppressions{};
 
@@ -310,6 +326,10 @@ public:
 #ifdef HAS_THREADING_MODEL_FORK
     /** @brief Load average value */
     int loadAverage{};
+
+    /** @brief How many files a process of the process executor checks
+        before it is replaced. 0 means no limit. Default is 1. (--process-max-files=N) */
+    unsigned int processMaxFiles = 1;
 #endif
 
     std::string manualUrl{"https://cppcheck.sourceforge.io/manual.pdf"};
@@ -529,6 +549,9 @@ public:
 
         /** @brief Maximum expression varid depth */
         int maxExprVarIdDepth = 4;
+
+        /** @brief How many functions of a single file are analyzed at the same time. Default is 1. (--function-jobs=N) */
+        unsigned int functionJobs = 1;
     };
 
     /** @brief The ValueFlow options */
@@ -7548,7 +7548,7 @@ static const Token* parsedecl(const Token* type,
         valuetype->type = ValueType::Type::RECORD;
     const bool cpp = type->isCpp();
     bool par = false;
-    while (Token::Match(type, "%name%|*|&|&&|::|(") && !Token::Match(type, "typename|template") && type->varId() == 0 &&
+    while (Token::Match(type, MATCH_PATTERN("%name%|*|&|&&|::|(")) && !Token::Match(type, MATCH_PATTERN("typename|template")) && type->varId() == 0 &&
            !type->variable() && !type->function()) {
         bool isIterator = false;
         if (type->str() == "(") {
@@ -7580,7 +7580,7 @@ static const Token* parsedecl(const Token* type,
             type->type() && type->type()->isTypeAlias() && type->type()->typeStart &&
             type->type()->typeStart->str() != type->str() && type->type()->typeStart != previousType)
             parsedecl(type->type()->typeStart, valuetype, defaultSignedness, settings);
-        else if (Token::Match(type, "const|constexpr"))
+        else if (Token::Match(type, MATCH_PATTERN("const|constexpr")))
             valuetype->constness |= (1 << (valuetype->pointer - pointer0));
         else if (Token::simpleMatch(type, "volatile"))
             valuetype->volatileness |= (1 << (valuetype->pointer - pointer0));
@@ -1939,7 +1939,7 @@ void TemplateSimplifier::expandTemplate(
             }
             startOfTemplateDeclaration = tok3;
         }
-        if (Token::Match(tok3, "(|["))
+        if (Token::Match(tok3, MATCH_PATTERN("(|[")))
             tok3 = tok3->link();
 
         // Start of template..
@@ -3433,7 +3433,7 @@ void TemplateSimplifier::replaceTemplateUsage(
 {
     std::list<std::pair<Token *, Token *>> removeTokens;
     for (Token *nameTok = mTokenList.front(); nameTok; nameTok = nameTok->next()) {
-        if (!Token::Match(nameTok, "%name% <") ||
+        if (!Token::Match(nameTok, MATCH_PATTERN("%name% <")) ||
             Token::Match(nameTok, "template|const_cast|dynamic_cast|reinterpret_cast|static_cast"))
             continue;
 
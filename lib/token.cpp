@@ -40,12 +40,14 @@
 #include <iostream>
 #include <iterator>
 #include <map>
+#include <new>
 #include <set>
 #include <sstream>
 #include <stack>
 #include <type_traits>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include <simplecpp.h>
 
@@ -58,15 +60,21 @@ namespace {
     };
 }
 
-const std::list<ValueFlow::Value> Token::mEmptyValueList;
+const std::vector<ValueFlow::Value> Token::mEmptyValueList;
 const std::string Token::mEmptyString;
 
 Token::Token(const TokenList& tokenlist, std::shared_ptr<TokensFrontBack> tokensFrontBack)
+    : Token(tokenlist, std::move(tokensFrontBack), new Impl)
+{}
+
+Token::Token(const TokenList& tokenlist, std::shared_ptr<TokensFrontBack> tokensFrontBack, Impl* impl)
     : mList(tokenlist)
     , mTokensFrontBack(std::move(tokensFrontBack))
-    , mImpl(new Impl)
+    , mStr(TokenStrings::getEmpty())
+    , mImpl(impl)
     , mIsC(mList.isC())
     , mIsCpp(mList.isCPP())
+    , mInArena(false)
 {}
 
 Token::Token(const Token* tok)
@@ -78,7 +86,41 @@ Token::Token(const Token* tok)
 
 Token::~Token()
 {
-    delete mImpl;
+    deleteImpl(mImpl);
+}
+
+Token* Token::create(const TokenList& tokenlist, std::shared_ptr<TokensFrontBack> tokensFrontBack)
+{
+    TokenArena& arena = tokensFrontBack->arena;
+    void* const tokenMemory = arena.allocate(sizeof(Token));
+    void* const implMemory = arena.allocate(sizeof(Impl));
+    Impl* const impl = new (implMemory) Impl;
+    impl->mInArena = true;
+    Token* const tok = new (tokenMemory) Token(tokenlist, std::move(tokensFrontBack), impl);
+    tok->mInArena = true;
+    return tok;
+}
+
+void Token::destroy(Token* tok)
+{
+    if (!tok->mInArena) {
+        delete tok;
+        return;
+    }
+    // the token might hold the last reference to the arena
+    const std::shared_ptr<TokensFrontBack> tokensFrontBack = tok->mTokensFrontBack;
+    tok->~Token();
+    tokensFrontBack->arena.deallocate(tok, sizeof(Token));
+}
+
+void Token::deleteImpl(Impl* impl) const
+{
+    if (impl && impl->mInArena) {
+        impl->~Impl();
+        mTokensFrontBack->arena.deallocate(impl, sizeof(Impl));
+    } else {
+        delete impl;
+    }
 }
 
 /*
@@ -114,8 +156,8 @@ void Token::update_property_info()
     // TODO: clear fIsLong
     isStandardType(false);
 
-    if (!mStr.empty()) {
-        if (mStr == "true" || mStr == "false") {
+    if (!str().empty()) {
+        if (str() == "true" || str() == "false") {
             if (mImpl->mVarId) {
                 if (mIsCpp)
                     throw InternalError(this, "Internal error. VarId set for bool literal.");
@@ -124,24 +166,24 @@ void Token::update_property_info()
             else
                 tokType(eBoolean);
         }
-        else if (isStringLiteral(mStr)) {
+        else if (isStringLiteral(str())) {
             tokType(eString);
-            isLong(isPrefixStringCharLiteral(mStr, '"', "L"));
+            isLong(isPrefixStringCharLiteral(str(), '"', "L"));
         }
-        else if (isCharLiteral(mStr)) {
+        else if (isCharLiteral(str())) {
             tokType(eChar);
-            isLong(isPrefixStringCharLiteral(mStr, '\'', "L"));
+            isLong(isPrefixStringCharLiteral(str(), '\'', "L"));
         }
-        else if (std::isalpha(static_cast<unsigned char>(mStr[0])) || mStr[0] == '_' || mStr[0] == '$') { // Name
+        else if (std::isalpha(static_cast<unsigned char>(str()[0])) || str()[0] == '_' || str()[0] == '$') { // Name
             if (mImpl->mVarId)
                 tokType(eVariable);
-            else if (mList.isKeyword(mStr)) {
+            else if (mList.isKeyword(str())) {
                 tokType(eKeyword);
                 update_property_isStandardType();
                 if (mTokType != eType) // cannot be a control-flow keyword when it is a type
-                    setFlag(fIsControlFlowKeyword, controlFlowKeywords.find(mStr) != controlFlowKeywords.end());
+                    setFlag(fIsControlFlowKeyword, controlFlowKeywords.find(str()) != controlFlowKeywords.end());
             }
-            else if (mStr == "asm") { // TODO: not a keyword
+            else if (str() == "asm") { // TODO: not a keyword
                 tokType(eKeyword);
             }
             else {
@@ -149,43 +191,43 @@ void Token::update_property_info()
                 // some types are not being treated as keywords
                 update_property_isStandardType();
             }
-        } else if (simplecpp::Token::isNumberLike(mStr)) {
-            if ((MathLib::isInt(mStr) || MathLib::isFloat(mStr)) && mStr.find('_') == std::string::npos)
+        } else if (simplecpp::Token::isNumberLike(str())) {
+            if ((MathLib::isInt(str()) || MathLib::isFloat(str())) && str().find('_') == std::string::npos)
                 tokType(eNumber);
             else
                 tokType(eLiteral); // assume it is a user defined literal
-        } else if (mStr == "=" || mStr == "<<=" || mStr == ">>=" ||
-                   (mStr.size() == 2U && mStr[1] == '=' && std::strchr("+-*/%&^|", mStr[0])))
+        } else if (str() == "=" || str() == "<<=" || str() == ">>=" ||
+                   (str().size() == 2U && str()[1] == '=' && std::strchr("+-*/%&^|", str()[0])))
             tokType(eAssignmentOp);
-        else if (mStr.size() == 1 && mStr.find_first_of(",[]()?:") != std::string::npos)
+        else if (str().size() == 1 && str().find_first_of(",[]()?:") != std::string::npos)
             tokType(eExtendedOp);
-        else if (mStr=="<<" || mStr==">>" || (mStr.size()==1 && mStr.find_first_of("+-*/%") != std::string::npos))
+        else if (str()=="<<" || str()==">>" || (str().size()==1 && str().find_first_of("+-*/%") != std::string::npos))
             tokType(eArithmeticalOp);
-        else if (mStr.size() == 1 && mStr.find_first_of("&|^~") != std::string::npos)
+        else if (str().size() == 1 && str().find_first_of("&|^~") != std::string::npos)
             tokType(eBitOp);
-        else if (mStr.size() <= 2 &&
-                 (mStr == "&&" ||
-                  mStr == "||" ||
-                  mStr == "!"))
+        else if (str().size() <= 2 &&
+                 (str() == "&&" ||
+                  str() == "||" ||
+                  str() == "!"))
             tokType(eLogicalOp);
         // TODO: should link check only apply to < and >? Token::link() suggests so
-        else if (mStr.size() <= 2 && !mLink &&
-                 (mStr == "==" ||
-                  mStr == "!=" ||
-                  mStr == "<" ||
-                  mStr == "<=" ||
-                  mStr == ">" ||
-                  mStr == ">="))
+        else if (str().size() <= 2 && !mLink &&
+                 (str() == "==" ||
+                  str() == "!=" ||
+                  str() == "<" ||
+                  str() == "<=" ||
+                  str() == ">" ||
+                  str() == ">="))
             tokType(eComparisonOp);
-        else if (mStr == "<=>")
+        else if (str() == "<=>")
             tokType(eComparisonOp);
-        else if (mStr.size() == 2 &&
-                 (mStr == "++" ||
-                  mStr == "--"))
+        else if (str().size() == 2 &&
+                 (str() == "++" ||
+                  str() == "--"))
             tokType(eIncDecOp);
-        else if (mStr.size() == 1 && (mStr.find_first_of("{}") != std::string::npos || (mLink && mStr.find_first_of("<>") != std::string::npos)))
+        else if (str().size() == 1 && (str().find_first_of("{}") != std::string::npos || (mLink && str().find_first_of("<>") != std::string::npos)))
             tokType(eBracket);
-        else if (mStr == "...")
+        else if (str() == "...")
             tokType(eEllipsis);
         else
             tokType(eOther);
@@ -217,10 +259,10 @@ bool Token::isStandardType(const std::string& s)
 
 void Token::update_property_isStandardType()
 {
-    if (mStr.size() < 3 || mStr.size() > 7)
+    if (str().size() < 3 || str().size() > 7)
         return;
 
-    if (isStandardType(mStr)) {
+    if (isStandardType(str())) {
         isStandardType(true);
         tokType(eType);
     }
@@ -230,26 +272,33 @@ bool Token::isUpperCaseName() const
 {
     if (!isName())
         return false;
-    return std::none_of(mStr.begin(), mStr.end(), [](char c) {
+    return std::none_of(str().begin(), str().end(), [](char c) {
         return std::islower(c);
     });
 }
 
 void Token::concatStr(std::string const& b)
 {
-    mStr.pop_back();
-    mStr.append(getStringLiteral(b) + "\"");
+    std::string s = str();
+    s.pop_back();
+    s.append(getStringLiteral(b) + "\"");
 
     if (isCChar() && isStringLiteral(b) && b[0] != '"') {
-        mStr.insert(0, b.substr(0, b.find('"')));
+        s.insert(0, b.substr(0, b.find('"')));
     }
+    internStr(s);
     update_property_info();
 }
 
+void Token::internStr(const std::string& s)
+{
+    mStr = mTokensFrontBack->strings.intern(s);
+}
+
 std::string Token::strValue() const
 {
     assert(mTokType == eString);
-    std::string ret(getStringLiteral(mStr));
+    std::string ret(getStringLiteral(str()));
     std::string::size_type pos = 0U;
     while ((pos = ret.find('\\', pos)) != std::string::npos) {
         ret.erase(pos,1U);
@@ -278,7 +327,7 @@ void Token::deleteNext(nonneg int count)
             n->mLink->link(nullptr);
 
         mNext = n->next();
-        delete n;
+        destroy(n);
         --count;
     }
 
@@ -298,7 +347,7 @@ void Token::deletePrevious(nonneg int count)
             p->mLink->link(nullptr);
 
         mPrevious = p->previous();
-        delete p;
+        destroy(p);
         --count;
     }
 
@@ -339,7 +388,7 @@ void Token::takeData(Token *fromToken)
     mStr = fromToken->mStr;
     tokType(fromToken->mTokType);
     mFlags = fromToken->mFlags;
-    delete mImpl;
+    deleteImpl(mImpl);
     mImpl = fromToken->mImpl;
     fromToken->mImpl = nullptr;
     if (mImpl->mTemplateSimplifierPointers)
@@ -399,7 +448,7 @@ void Token::replace(Token *replaceThis, Token *start, Token *end)
         tok->mImpl->mProgressValue = replaceThis->mImpl->mProgressValue;
 
     // Delete old token, which is replaced
-    delete replaceThis;
+    destroy(replaceThis);
 }
 
 /**
@@ -620,7 +669,7 @@ bool Token::simpleMatch(const Token *tok, const char pattern[], size_t pattern_l
     while (*current) {
         const std::size_t length = next - current;
 
-        if (!tok || length != tok->mStr.length() || std::strncmp(current, tok->mStr.c_str(), length) != 0)
+        if (!tok || length != tok->str().length() || std::strncmp(current, tok->str().c_str(), length) != 0)
             return false;
 
         current = next;
@@ -874,7 +923,7 @@ static bool isOperator(const Token *tok)
 
 const Token * Token::findClosingBracket() const
 {
-    if (mStr != "<")
+    if (str() != "<")
         return nullptr;
 
     if (!mPrevious)
@@ -939,7 +988,7 @@ Token * Token::findClosingBracket()
 
 const Token * Token::findOpeningBracket() const
 {
-    if (mStr != ">")
+    if (str() != ">")
         return nullptr;
 
     const Token *opening = nullptr;
@@ -1063,10 +1112,10 @@ void Token::function(const Function *f)
 Token* Token::insertToken(const std::string& tokenStr, bool prepend)
 {
     Token *newToken;
-    if (mStr.empty())
+    if (str().empty())
         newToken = this;
     else
-        newToken = new Token(mList, mTokensFrontBack);
+        newToken = create(mList, mTokensFrontBack);
     newToken->str(tokenStr);
 
     if (newToken != this) {
@@ -1132,7 +1181,7 @@ Token* Token::insertToken(const std::string& tokenStr, bool prepend)
                 // Or it might be a namespace/class/struct
                 if (Token::Match(newToken->previous(), "%name%|>")) {
                     Token* nameTok = newToken->previous();
-                    while (nameTok && !Token::Match(nameTok, "namespace|class|struct|union %name% {|::|:|<")) {
+                    while (nameTok && !Token::Match(nameTok, MATCH_PATTERN("namespace|class|struct|union %name% {|::|:|<"))) {
                         nameTok = nameTok->previous();
                     }
                     if (nameTok) {
@@ -1283,15 +1332,15 @@ std::string Token::stringify(const stringifyOptions& options) const
     }
     if (options.macro && isExpandedMacro())
         ret += '$';
-    if (isName() && mStr.find(' ') != std::string::npos) {
-        for (const char i : mStr) {
+    if (isName() && str().find(' ') != std::string::npos) {
+        for (const char i : str()) {
             if (i != ' ')
                 ret += i;
         }
-    } else if (mStr[0] != '\"' || mStr.find('\0') == std::string::npos)
-        ret += mStr;
+    } else if (str()[0] != '\"' || str().find('\0') == std::string::npos)
+        ret += str();
     else {
-        for (const char i : mStr) {
+        for (const char i : str()) {
             if (i == '\0')
                 ret += "\\0";
             else
@@ -1622,7 +1671,7 @@ static std::string stringFromTokenRange(const Token* start, const Token* end)
             ret += tok->str();
         } else
             ret += tok->originalName();
-        if (Token::Match(tok, "%name%|%num% %name%|%num%"))
+        if (Token::Match(tok, MATCH_PATTERN("%name%|%num% %name%|%num%")))
             ret += ' ';
     }
     return ret;
@@ -1699,7 +1748,7 @@ void Token::astStringVerboseRecursive(std::string& ret, const nonneg int indent1
 {
     if (isExpandedMacro())
         ret += '$';
-    ret += mStr;
+    ret += str();
     if (mImpl->mValueType)
         ret += " \'" + mImpl->mValueType->str() + '\'';
     if (function()) {
@@ -2024,7 +2073,7 @@ static bool isAdjacent(const ValueFlow::Value& x, const ValueFlow::Value& y)
     return std::abs(x.intvalue - y.intvalue) == 1;
 }
 
-static bool removePointValue(std::list<ValueFlow::Value>& values, std::list<ValueFlow::Value>::iterator& x)
+static bool removePointValue(std::vector<ValueFlow::Value>& values, std::vector<ValueFlow::Value>::iterator& x)
 {
     const bool isPoint = x->bound == ValueFlow::Value::Bound::Point;
     if (!isPoint)
@@ -2034,7 +2083,7 @@ static bool removePointValue(std::list<ValueFlow::Value>& values, std::list<Valu
     return isPoint;
 }
 
-static bool removeContradiction(std::list<ValueFlow::Value>& values)
+static bool removeContradiction(std::vector<ValueFlow::Value>& values)
 {
     bool result = false;
     for (auto itx = values.begin(); itx != values.end(); ++itx) {
@@ -2055,7 +2104,7 @@ static bool removeContradiction(std::list<ValueFlow::Value>& values)
             if (itx->isSymbolicValue() && !ValueFlow::Value::sameToken(itx->tokvalue, ity->tokvalue))
                 continue;
             if (!itx->equalValue(*ity)) {
-                auto compare = [](const std::list<ValueFlow::Value>::const_iterator& x, const std::list<ValueFlow::Value>::const_iterator& y) {
+                auto compare = [](const std::vector<ValueFlow::Value>::const_iterator& x, const std::vector<ValueFlow::Value>::const_iterator& y) {
                     return x->compareValue(*y, less{});
                 };
                 auto itMax = std::max(itx, ity, compare);
@@ -2073,20 +2122,21 @@ static bool removeContradiction(std::list<ValueFlow::Value>& values)
             }
             const bool removex = !itx->isImpossible() || ity->isKnown();
             const bool removey = !ity->isImpossible() || itx->isKnown();
+            // ity is after itx so it must be erased first to keep itx valid
             if (itx->bound == ity->bound) {
-                if (removex)
-                    values.erase(itx);
                 if (removey)
                     values.erase(ity);
+                if (removex)
+                    values.erase(itx);
                 // itx and ity are invalidated
                 return true;
             }
             result = removex || removey;
             bool bail = false;
-            if (removex && removePointValue(values, itx))
-                bail = true;
             if (removey && removePointValue(values, ity))
                 bail = true;
+            if (removex && removePointValue(values, itx))
+                bail = true;
             if (bail)
                 return true;
         }
@@ -2094,63 +2144,68 @@ static bool removeContradiction(std::list<ValueFlow::Value>& values)
     return result;
 }
 
-using ValueIterator = std::list<ValueFlow::Value>::iterator;
-
 template<class Iterator>
 // NOLINTNEXTLINE(performance-unnecessary-value-param) - false positive
-static ValueIterator removeAdjacentValues(std::list<ValueFlow::Value>& values, ValueIterator x, Iterator start, Iterator last)
+static std::size_t removeAdjacentValues(std::vector<ValueFlow::Value>& values, std::size_t x, Iterator start, Iterator last)
 {
-    if (!isAdjacent(*x, **start))
-        return std::next(x);
-    auto it = std::adjacent_find(start, last, [](ValueIterator x, ValueIterator y) {
-        return !isAdjacent(*x, *y);
+    if (!isAdjacent(values[x], values[*start]))
+        return x + 1;
+    auto it = std::adjacent_find(start, last, [&values](std::size_t y1, std::size_t y2) {
+        return !isAdjacent(values[y1], values[y2]);
     });
     if (it == last)
         it--;
-    (*it)->bound = x->bound;
-    std::for_each(std::move(start), std::move(it), [&](ValueIterator y) {
-        values.erase(y);
+    values[*it].bound = values[x].bound;
+    std::vector<std::size_t> removed(start, it);
+    removed.push_back(x);
+    std::sort(removed.begin(), removed.end(), std::greater<std::size_t>{});
+    for (const std::size_t y : removed)
+        values.erase(values.begin() + y);
+    // continue with the value that followed x
+    return x - std::count_if(removed.cbegin(), removed.cend(), [&](std::size_t y) {
+        return y < x;
     });
-    return values.erase(x);
 }
 
-static void mergeAdjacent(std::list<ValueFlow::Value>& values)
+static void mergeAdjacent(std::vector<ValueFlow::Value>& values)
 {
-    for (auto x = values.begin(); x != values.end();) {
-        if (x->isNonValue()) {
+    for (std::size_t x = 0; x < values.size();) {
+        const ValueFlow::Value& vx = values[x];
+        if (vx.isNonValue()) {
             x++;
             continue;
         }
-        if (x->bound == ValueFlow::Value::Bound::Point) {
+        if (vx.bound == ValueFlow::Value::Bound::Point) {
             x++;
             continue;
         }
-        std::vector<ValueIterator> adjValues;
-        for (auto y = values.begin(); y != values.end(); y++) {
+        std::vector<std::size_t> adjValues;
+        for (std::size_t y = 0; y < values.size(); y++) {
             if (x == y)
                 continue;
-            if (y->isNonValue())
+            const ValueFlow::Value& vy = values[y];
+            if (vy.isNonValue())
                 continue;
-            if (x->valueType != y->valueType)
+            if (vx.valueType != vy.valueType)
                 continue;
-            if (x->valueKind != y->valueKind)
+            if (vx.valueKind != vy.valueKind)
                 continue;
-            if (x->isSymbolicValue() && !ValueFlow::Value::sameToken(x->tokvalue, y->tokvalue))
+            if (vx.isSymbolicValue() && !ValueFlow::Value::sameToken(vx.tokvalue, vy.tokvalue))
                 continue;
-            if (x->bound != y->bound) {
-                if (y->bound != ValueFlow::Value::Bound::Point && isAdjacent(*x, *y)) {
+            if (vx.bound != vy.bound) {
+                if (vy.bound != ValueFlow::Value::Bound::Point && isAdjacent(vx, vy)) {
                     adjValues.clear();
                     break;
                 }
                 // No adjacent points for floating points
-                if (x->valueType == ValueFlow::Value::ValueType::FLOAT)
+                if (vx.valueType == ValueFlow::Value::ValueType::FLOAT)
                     continue;
-                if (y->bound != ValueFlow::Value::Bound::Point)
+                if (vy.bound != ValueFlow::Value::Bound::Point)
                     continue;
             }
-            if (x->bound == ValueFlow::Value::Bound::Lower && !y->compareValue(*x, less{}))
+            if (vx.bound == ValueFlow::Value::Bound::Lower && !vy.compareValue(vx, less{}))
                 continue;
-            if (x->bound == ValueFlow::Value::Bound::Upper && !x->compareValue(*y, less{}))
+            if (vx.bound == ValueFlow::Value::Bound::Upper && !vx.compareValue(vy, less{}))
                 continue;
             adjValues.push_back(y);
         }
@@ -2158,28 +2213,27 @@ static void mergeAdjacent(std::list<ValueFlow::Value>& values)
             x++;
             continue;
         }
-        std::sort(adjValues.begin(), adjValues.end(), [&values](ValueIterator xx, ValueIterator yy) {
-            (void)values;
-            assert(xx != values.end() && yy != values.end());
-            return xx->compareValue(*yy, less{});
+        std::sort(adjValues.begin(), adjValues.end(), [&values](std::size_t xx, std::size_t yy) {
+            return values[xx].compareValue(values[yy], less{});
         });
-        if (x->bound == ValueFlow::Value::Bound::Lower)
-            x = removeAdjacentValues(values, x, adjValues.rbegin(), adjValues.rend());
-        else if (x->bound == ValueFlow::Value::Bound::Upper)
-            x = removeAdjacentValues(values, x, adjValues.begin(), adjValues.end());
+        if (vx.bound == ValueFlow::Value::Bound::Lower)
+            x = removeAdjacentValues(values, x, adjValues.crbegin(), adjValues.crend());
+        else if (vx.bound == ValueFlow::Value::Bound::Upper)
+            x = removeAdjacentValues(values, x, adjValues.cbegin(), adjValues.cend());
     }
 }
 
-static void removeOverlaps(std::list<ValueFlow::Value>& values)
+static void removeOverlaps(std::vector<ValueFlow::Value>& values)
 {
-    for (const ValueFlow::Value& x : values) {
+    // a value only needs to be compared with the values after it, the ones
+    // before it have already removed their duplicates
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        const ValueFlow::Value& x = values[i];
         if (x.isNonValue())
             continue;
-        values.remove_if([&](const ValueFlow::Value& y) {
+        values.erase(std::remove_if(values.begin() + i + 1, values.end(), [&](const ValueFlow::Value& y) {
             if (y.isNonValue())
                 return false;
-            if (&x == &y)
-                return false;
             if (x.valueType != y.valueType)
                 return false;
             if (x.valueKind != y.valueKind)
@@ -2191,14 +2245,14 @@ static void removeOverlaps(std::list<ValueFlow::Value>& values)
             if (x.bound != y.bound)
                 return false;
             return true;
-        });
+        }), values.end());
     }
     mergeAdjacent(values);
 }
 
 // Removing contradictions is an NP-hard problem. Instead we run multiple
 // passes to try to catch most contradictions
-static void removeContradictions(std::list<ValueFlow::Value>& values)
+static void removeContradictions(std::vector<ValueFlow::Value>& values)
 {
     removeOverlaps(values);
     for (int i = 0; i < 4; i++) {
@@ -2218,13 +2272,52 @@ static bool sameValueType(const ValueFlow::Value& x, const ValueFlow::Value& y)
     return true;
 }
 
+// Fingerprint of the values which does not depend on their order. The error paths are ignored.
+static std::size_t valuesFingerprint(const std::vector<ValueFlow::Value>* values)
+{
+    if (!values)
+        return 0;
+    std::size_t fingerprint = values->size();
+    for (const ValueFlow::Value& v : *values) {
+        std::size_t h = static_cast<std::size_t>(v.valueType);
+        const auto combine = [&h](std::size_t x) {
+            h ^= x + 0x9e3779b9 + (h << 6) + (h >> 2);
+        };
+        combine(static_cast<std::size_t>(v.valueKind));
+        combine(static_cast<std::size_t>(v.bound));
+        combine(std::hash<MathLib::bigint>{}(v.intvalue));
+        combine(std::hash<const Token*>{}(v.tokvalue));
+        combine(std::hash<double>{}(v.floatValue));
+        combine(std::hash<MathLib::bigint>{}(v.varvalue));
+        combine(std::hash<const Token*>{}(v.condition));
+        combine(v.varId);
+        combine(static_cast<std::size_t>(v.indirect));
+        combine(static_cast<std::size_t>(v.conditional) | (static_cast<std::size_t>(v.defaultArg) << 1));
+        combine(static_cast<std::size_t>(v.moveKind));
+        combine(static_cast<std::size_t>(v.lifetimeKind));
+        combine(static_cast<std::size_t>(v.lifetimeScope));
+        combine(std::hash<MathLib::bigint>{}(v.path));
+        fingerprint += h;
+    }
+    return fingerprint;
+}
+
 bool Token::addValue(const ValueFlow::Value &value)
+{
+    const std::size_t fingerprint = valuesFingerprint(mImpl->mValues);
+    const bool added = insertValue(value);
+    if (valuesFingerprint(mImpl->mValues) != fingerprint)
+        mTokensFrontBack->valueChanged(mImpl->mScope);
+    return added;
+}
+
+bool Token::insertValue(const ValueFlow::Value &value)
 {
     if (value.isKnown() && mImpl->mValues) {
         // Clear all other values of the same type since value is known
-        mImpl->mValues->remove_if([&](const ValueFlow::Value& x) {
+        mImpl->mValues->erase(std::remove_if(mImpl->mValues->begin(), mImpl->mValues->end(), [&](const ValueFlow::Value& x) {
             return sameValueType(x, value);
-        });
+        }), mImpl->mValues->end());
     }
 
     // Don't add a value if its already known
@@ -2280,7 +2373,7 @@ bool Token::addValue(const ValueFlow::Value &value)
             if (v.varId == 0)
                 v.varId = mImpl->mVarId;
             if (v.isKnown() && v.isIntValue())
-                mImpl->mValues->push_front(std::move(v));
+                mImpl->mValues->insert(mImpl->mValues->begin(), std::move(v));
             else
                 mImpl->mValues->push_back(std::move(v));
         }
@@ -2288,7 +2381,7 @@ bool Token::addValue(const ValueFlow::Value &value)
         ValueFlow::Value v(value);
         if (v.varId == 0)
             v.varId = mImpl->mVarId;
-        mImpl->mValues = new std::list<ValueFlow::Value>;
+        mImpl->mValues = new std::vector<ValueFlow::Value>;
         mImpl->mValues->push_back(std::move(v));
     }
 
@@ -2297,6 +2390,16 @@ bool Token::addValue(const ValueFlow::Value &value)
     return true;
 }
 
+void Token::removeValues(std::function<bool(const ValueFlow::Value &)> pred)
+{
+    if (!mImpl->mValues)
+        return;
+    const std::size_t size = mImpl->mValues->size();
+    mImpl->mValues->erase(std::remove_if(mImpl->mValues->begin(), mImpl->mValues->end(), std::move(pred)), mImpl->mValues->end());
+    if (mImpl->mValues->size() != size)
+        mTokensFrontBack->valueChanged(mImpl->mScope);
+}
+
 void Token::assignProgressValues(Token *tok)
 {
     int total_count = 0;
@@ -2578,7 +2681,7 @@ const ValueFlow::Value* Token::getValue(const MathLib::bigint val) const
 }
 
 template<class Compare>
-static const ValueFlow::Value* getCompareValue(const std::list<ValueFlow::Value>& values,
+static const ValueFlow::Value* getCompareValue(const std::vector<ValueFlow::Value>& values,
                                                bool condition,
                                                MathLib::bigint path,
                                                Compare compare)
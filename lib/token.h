@@ -23,6 +23,7 @@
 
 #include "config.h"
 #include "errortypes.h"
+#include "matchcompiler.h"
 #include "mathlib.h"
 #include "smallvector.h"
 #include "templatesimplifier.h"
@@ -33,9 +34,9 @@
 #include <cassert>
 #include <cstdint>
 #include <cstddef>
+#include <cstring>
 #include <functional>
 #include <limits>
-#include <list>
 #include <memory>
 #include <ostream>
 #include <set>
@@ -137,7 +138,7 @@ private:
         ValueType* mValueType{};
 
         // ValueFlow
-        std::list<ValueFlow::Value>* mValues{};
+        std::vector<ValueFlow::Value>* mValues{};
 
         // Pointer to a template in the template simplifier
         std::set<TemplateSimplifier::TokenAndName*>* mTemplateSimplifierPointers{};
@@ -174,6 +175,9 @@ private:
 
         std::int8_t mMutableExpr{-1};
 
+        // Allocated in the arena of the token list
+        bool mInArena{};
+
         void setCppcheckAttribute(CppcheckAttributesType attrType, MathLib::bigint value);
         bool getCppcheckAttribute(CppcheckAttributesType attrType, MathLib::bigint &value) const;
 
@@ -209,11 +213,20 @@ public:
     explicit Token(const Token *tok);
     ~Token();
 
+    /**
+     * Create a token in the arena of the token list. The data of the token is placed right after it.
+     * @return the token, it must be destroyed with destroy()
+     */
+    static Token* create(const TokenList& tokenlist, std::shared_ptr<TokensFrontBack> tokensFrontBack);
+
+    /** Destroy a token created with create() or new */
+    static void destroy(Token* tok);
+
     ConstTokenRange until(const Token * t) const;
 
     template<typename T>
     void str(T&& s) {
-        mStr = s;
+        internStr(s);
         mImpl->mVarId = 0;
 
         update_property_info();
@@ -226,7 +239,23 @@ public:
     void concatStr(std::string const& b);
 
     const std::string &str() const {
-        return mStr;
+        return mStr->first;
+    }
+
+    /**
+     * @return true if the tokens have the same string. The string data is only compared if the
+     * tokens are in different lists.
+     */
+    static bool sameStr(const Token* tok1, const Token* tok2) {
+        return tok1->mStr == tok2->mStr || (tok1->mTokensFrontBack != tok2->mTokensFrontBack && tok1->str() == tok2->str());
+    }
+
+    /**
+     * @return the id of the string in the list, see TokenStrings. The keywords and punctuators
+     * have the same id in every list.
+     */
+    std::uint32_t strId() const {
+        return mStr->second;
     }
 
     /**
@@ -278,7 +307,7 @@ public:
     const std::string &strAt(int idx) const
     {
         const Token *tok = this->tokAt(idx);
-        return tok ? tok->mStr : mEmptyString;
+        return tok ? tok->str() : mEmptyString;
     }
 
     /**
@@ -352,6 +381,16 @@ public:
      */
     static bool Match(const Token *tok, const char pattern[], nonneg int varid = 0);
 
+    /**
+     * Match given token (or list of tokens) to a pattern which is compiled at
+     * compile time, e.g. Match(tok, MATCH_PATTERN("%name% (")).
+     * The patterns are the same as for the runtime Match().
+     */
+    template<class Pattern, REQUIRES("Pattern must be created with MATCH_PATTERN", std::is_base_of<MatchCompiler::Pattern, Pattern> )>
+    static bool Match(const Token *tok, Pattern /*pattern*/, nonneg int varid = 0) {
+        return MatchCompiler::match<Pattern>(tok, varid);
+    }
+
     /**
      * @return length of C-string.
      *
@@ -458,7 +497,7 @@ public:
         return astOperand1() != nullptr && astOperand2() != nullptr;
     }
     bool isUnaryOp(const std::string &s) const {
-        return s == mStr && astOperand1() != nullptr && astOperand2() == nullptr;
+        return s == str() && astOperand1() != nullptr && astOperand2() == nullptr;
     }
     bool isUnaryPreOp() const;
 
@@ -804,27 +843,27 @@ public:
     }
 
     bool isUtf8() const {
-        return (((mTokType == eString) && isPrefixStringCharLiteral(mStr, '"', "u8")) ||
-                ((mTokType == eChar) && isPrefixStringCharLiteral(mStr, '\'', "u8")));
+        return (((mTokType == eString) && isPrefixStringCharLiteral(str(), '"', "u8")) ||
+                ((mTokType == eChar) && isPrefixStringCharLiteral(str(), '\'', "u8")));
     }
 
     bool isUtf16() const {
-        return (((mTokType == eString) && isPrefixStringCharLiteral(mStr, '"', "u")) ||
-                ((mTokType == eChar) && isPrefixStringCharLiteral(mStr, '\'', "u")));
+        return (((mTokType == eString) && isPrefixStringCharLiteral(str(), '"', "u")) ||
+                ((mTokType == eChar) && isPrefixStringCharLiteral(str(), '\'', "u")));
     }
 
     bool isUtf32() const {
-        return (((mTokType == eString) && isPrefixStringCharLiteral(mStr, '"', "U")) ||
-                ((mTokType == eChar) && isPrefixStringCharLiteral(mStr, '\'', "U")));
+        return (((mTokType == eString) && isPrefixStringCharLiteral(str(), '"', "U")) ||
+                ((mTokType == eChar) && isPrefixStringCharLiteral(str(), '\'', "U")));
     }
 
     bool isCChar() const {
-        return (((mTokType == eString) && isPrefixStringCharLiteral(mStr, '"', "")) ||
-                ((mTokType == eChar) && isPrefixStringCharLiteral(mStr, '\'', "") && (replaceEscapeSequences(getCharLiteral(mStr)).size() == 1)));
+        return (((mTokType == eString) && isPrefixStringCharLiteral(str(), '"', "")) ||
+                ((mTokType == eChar) && isPrefixStringCharLiteral(str(), '\'', "") && (replaceEscapeSequences(getCharLiteral(str())).size() == 1)));
     }
 
     bool isCMultiChar() const {
-        return (mTokType == eChar) && isPrefixStringCharLiteral(mStr, '\'', "") && (replaceEscapeSequences(getCharLiteral(mStr)).size() > 1);
+        return (mTokType == eChar) && isPrefixStringCharLiteral(str(), '\'', "") && (replaceEscapeSequences(getCharLiteral(str())).size() > 1);
     }
 
     /**
@@ -1184,7 +1223,7 @@ public:
             return;
 
         mLink = linkToToken;
-        if (mStr == "<" || mStr == ">")
+        if (str() == "<" || str() == ">")
             update_property_info();
     }
 
@@ -1366,7 +1405,7 @@ public:
         return mImpl->mOriginalName ? *mImpl->mOriginalName : mEmptyString;
     }
 
-    const std::list<ValueFlow::Value>& values() const {
+    const std::vector<ValueFlow::Value>& values() const {
         return mImpl->mValues ? *mImpl->mValues : mEmptyValueList;
     }
 
@@ -1421,10 +1460,7 @@ public:
     /** Add token value. Return true if value is added. */
     bool addValue(const ValueFlow::Value &value);
 
-    void removeValues(std::function<bool(const ValueFlow::Value &)> pred) {
-        if (mImpl->mValues)
-            mImpl->mValues->remove_if(std::move(pred));
-    }
+    void removeValues(std::function<bool(const ValueFlow::Value &)> pred);
 
     nonneg int index() const {
         return mImpl->mIndex;
@@ -1433,7 +1469,7 @@ public:
     void assignIndexes();
 
 private:
-    static const std::list<ValueFlow::Value> mEmptyValueList;
+    static const std::vector<ValueFlow::Value> mEmptyValueList;
 
     void next(Token *nextToken) {
         mNext = nextToken;
@@ -1445,6 +1481,9 @@ private:
     /** used by deleteThis() to take data from token to delete */
     void takeData(Token *fromToken);
 
+    /** used by addValue() to add the value */
+    bool insertValue(const ValueFlow::Value &value);
+
     /**
      * Works almost like strcmp() except returns only true or false and
      * if s has empty space &apos; &apos; character, that character is handled
@@ -1463,7 +1502,8 @@ private:
     RET_NONNULL Token* insertToken(const std::string& tokenStr, const std::string& originalNameStr, bool prepend);
     RET_NONNULL Token* insertToken(const std::string& tokenStr, const std::string& originalNameStr, const std::string& macroNameStr, bool prepend);
 
-    std::string mStr;
+    /** the string, it is stored in the strings of the list */
+    const std::pair<const std::string, std::uint32_t>* mStr;
 
     Token* mNext{};
     Token* mPrevious{};
@@ -1563,6 +1603,15 @@ private:
     // cppcheck-suppress premium-misra-cpp-2023-12.2.1
     bool mIsC : 1;
     bool mIsCpp : 1;
+    bool mInArena : 1;
+
+    Token(const TokenList& tokenlist, std::shared_ptr<TokensFrontBack> tokensFrontBack, Impl* impl);
+
+    /** Delete the data of a token of this list */
+    void deleteImpl(Impl* impl) const;
+
+    /** Set the string without updating the properties */
+    void internStr(const std::string& s);
 
 public:
     void astOperand1(Token *tok);
@@ -1659,7 +1708,7 @@ public:
             ret = mImpl->mAstOperand1->astString(sep);
         if (mImpl->mAstOperand2)
             ret += mImpl->mAstOperand2->astString(sep);
-        return ret + sep + mStr;
+        return ret + sep + str();
     }
 
     std::string astStringVerbose() const;
@@ -1700,6 +1749,149 @@ public:
     }
 };
 
+namespace MatchCompiler {
+    inline bool equalsLiteral(const std::string& str, const char* literal, std::size_t length) {
+        return str.size() == length && std::memcmp(str.data(), literal, length) == 0;
+    }
+
+    /** match the characters of a "[...]" word. A "]" only matches if it is given twice, e.g. "[]]]" */
+    template<class P, std::size_t Pos, std::size_t End>
+    struct CharsMatcher {
+        static bool match(char c) {
+            return (P::str()[Pos] != ']' && c == P::str()[Pos]) || CharsMatcher<P, Pos + 1, End>::match(c);
+        }
+    };
+
+    template<class P, std::size_t End>
+    struct CharsMatcher<P, End, End> {
+        static bool match(char /*c*/) {
+            return false;
+        }
+    };
+
+    template<class P, std::size_t W, std::size_t A>
+    inline bool matchAlternative(const Token* tok, nonneg int varid) {
+        constexpr Alternative alternative = makeAlternative(P::str(), wordBegin(P::str(), W), A);
+        switch (alternative.kind) {
+        case Kind::literal:
+            return equalsLiteral(tok->str(), P::str() + alternative.begin, alternative.end - alternative.begin);
+        case Kind::any:
+            return true;
+        case Kind::assign:
+            return tok->isAssignmentOp();
+        case Kind::boolean:
+            return tok->isBoolean();
+        case Kind::character:
+            return tok->tokType() == Token::eChar;
+        case Kind::comp:
+            return tok->isComparisonOp();
+        case Kind::cop:
+            return tok->isConstOp();
+        case Kind::name:
+            return tok->isName();
+        case Kind::num:
+            return tok->isNumber();
+        case Kind::op:
+            return tok->isOp();
+        case Kind::orOp:
+            return tok->tokType() == Token::eBitOp && tok->str() == "|";
+        case Kind::ororOp:
+            return tok->tokType() == Token::eLogicalOp && tok->str() == "||";
+        case Kind::str:
+            return tok->tokType() == Token::eString;
+        case Kind::type:
+            return tok->isName() && tok->varId() == 0;
+        case Kind::var:
+            return tok->varId() != 0;
+        case Kind::varid:
+            if (varid == 0)
+                throw InternalError(tok, "Internal error. Token::Match called with varid 0.");
+            return tok->varId() == varid;
+        case Kind::alternatives:
+        case Kind::chars:
+        case Kind::notLiteral:
+            break;
+        }
+        return false;
+    }
+
+    template<class P, std::size_t W, std::size_t A, std::size_t Count>
+    struct AlternativesMatcher {
+        static bool match(const Token* tok, nonneg int varid) {
+            return matchAlternative<P, W, A>(tok, varid) || AlternativesMatcher<P, W, A + 1, Count>::match(tok, varid);
+        }
+    };
+
+    template<class P, std::size_t W, std::size_t Count>
+    struct AlternativesMatcher<P, W, Count, Count> {
+        static bool match(const Token* /*tok*/, nonneg int /*varid*/) {
+            return false;
+        }
+    };
+
+    /** match a word and move tok to the token which is matched by the next word */
+    template<class P, std::size_t W, Kind K = makeWord(P::str(), W).kind>
+    struct WordMatcher {
+        static bool match(const Token*& tok, nonneg int varid) {
+            constexpr Word word = makeWord(P::str(), W);
+            if (!tok)
+                return false;
+            if (AlternativesMatcher<P, W, 0, word.alternatives>::match(tok, varid)) {
+                tok = tok->next();
+                return true;
+            }
+            return word.optional;
+        }
+    };
+
+    template<class P, std::size_t W>
+    struct WordMatcher<P, W, Kind::chars> {
+        static bool match(const Token*& tok, nonneg int /*varid*/) {
+            constexpr Alternative chars = makeAlternative(P::str(), wordBegin(P::str(), W), 0);
+            if (!tok || tok->str().size() != 1)
+                return false;
+            const char c = tok->str()[0];
+            if (!CharsMatcher<P, chars.begin, chars.end>::match(c) && !(c == ']' && count(P::str(), chars.begin, chars.end, ']') > 1))
+                return false;
+            tok = tok->next();
+            return true;
+        }
+    };
+
+    template<class P, std::size_t W>
+    struct WordMatcher<P, W, Kind::notLiteral> {
+        static bool match(const Token*& tok, nonneg int /*varid*/) {
+            constexpr Alternative literal = makeAlternative(P::str(), wordBegin(P::str(), W), 0);
+            if (!tok)
+                return true;
+            if (equalsLiteral(tok->str(), P::str() + literal.begin, literal.end - literal.begin))
+                return false;
+            tok = tok->next();
+            return true;
+        }
+    };
+
+    template<class P, std::size_t W, std::size_t Count>
+    struct WordsMatcher {
+        static bool match(const Token* tok, nonneg int varid) {
+            return WordMatcher<P, W>::match(tok, varid) && WordsMatcher<P, W + 1, Count>::match(tok, varid);
+        }
+    };
+
+    template<class P, std::size_t Count>
+    struct WordsMatcher<P, Count, Count> {
+        static bool match(const Token* /*tok*/, nonneg int /*varid*/) {
+            return true;
+        }
+    };
+
+    template<class P>
+    bool match(const Token* tok, nonneg int varid) {
+        static_assert(countWords(P::str()) > 0, "empty pattern");
+        return WordsMatcher<P, 0, countWords(P::str())>::match(tok, varid);
+    }
+}
+
 Token* findTypeEnd(Token* tok);
 Token* findLambdaEndScope(Token* tok);
 const Token* findLambdaEndScope(const Token* tok);
@@ -119,7 +119,8 @@ Tokenizer::Tokenizer(TokenList tokenList, ErrorLogger &errorLogger) :
     list(std::move(tokenList)),
     mSettings(list.getSettings()),
     mErrorLogger(errorLogger),
-    mTemplateSimplifier(new TemplateSimplifier(*this))
+    mTemplateSimplifier(new TemplateSimplifier(*this)),
+    mValueFlowProducts(ValueFlow::getAllProducts())
 {}
 
 Tokenizer::~Tokenizer()
@@ -2894,8 +2895,8 @@ namespace {
 
 bool Tokenizer::isMemberFunction(const Token *openParen)
 {
-    return (Token::Match(openParen->tokAt(-2), ":: %name% (") ||
-            Token::Match(openParen->tokAt(-3), ":: ~ %name% (")) &&
+    return (Token::Match(openParen->tokAt(-2), MATCH_PATTERN(":: %name% (")) ||
+            Token::Match(openParen->tokAt(-3), MATCH_PATTERN(":: ~ %name% ("))) &&
            TokenList::isFunctionHead(openParen, "{:");
 }
 
@@ -2949,7 +2950,7 @@ bool Tokenizer::simplifyUsing()
 
     // simplify using N::x; to using x = N::x;
     for (Token* tok = list.front(); tok; tok = tok->next()) {
-        if (!Token::Match(tok, "using ::| %name% ::"))
+        if (!Token::Match(tok, MATCH_PATTERN("using ::| %name% ::")))
             continue;
         const Token* ns = tok->tokAt(tok->strAt(1) == "::" ? 2 : 1);
         if (ns->isKeyword())
@@ -2993,7 +2994,7 @@ bool Tokenizer::simplifyUsing()
         if (Settings::terminated())
             return substitute;
 
-        if (Token::Match(tok, "enum class|struct")) {
+        if (Token::Match(tok, MATCH_PATTERN("enum class|struct"))) {
             Token *bodyStart = tok;
             while (Token::Match(bodyStart, "%name%|:|::|<")) {
                 if (bodyStart->str() == "<")
@@ -3005,8 +3006,8 @@ bool Tokenizer::simplifyUsing()
             continue;
         }
 
-        if (Token::Match(tok, "{|}|namespace|class|struct|union") ||
-            Token::Match(tok, "using namespace %name% ;|::")) {
+        if (Token::Match(tok, MATCH_PATTERN("{|}|namespace|class|struct|union")) ||
+            Token::Match(tok, MATCH_PATTERN("using namespace %name% ;|::"))) {
             try {
                 setScopeInfo(tok, currentScope, mSettings.debugwarnings);
             } catch (const std::runtime_error &) {
@@ -3017,7 +3018,7 @@ bool Tokenizer::simplifyUsing()
         }
 
         // skip template declarations
-        if (Token::Match(tok, "template < !!>")) {
+        if (Token::Match(tok, MATCH_PATTERN("template < !!>"))) {
             // add template record type to scope info
             const Token *end = tok->next()->findClosingBracket();
             if (end && Token::Match(end->next(), "class|struct|union %name%"))
@@ -3031,8 +3032,8 @@ bool Tokenizer::simplifyUsing()
 
         // look for non-template type aliases
         if (!(tok->strAt(-1) != ">" &&
-              (Token::Match(tok, "using %name% = ::| %name%") ||
-               (Token::Match(tok, "using %name% [ [") &&
+              (Token::Match(tok, MATCH_PATTERN("using %name% = ::| %name%")) ||
+               (Token::Match(tok, MATCH_PATTERN("using %name% [ [")) &&
                 Token::Match(tok->linkAt(2), "] ] = ::| %name%")))))
             continue;
 
@@ -3169,8 +3170,8 @@ bool Tokenizer::simplifyUsing()
                 continue;
             }
 
-            if ((Token::Match(tok1, "{|}|namespace|class|struct|union") && tok1->strAt(-1) != "using") ||
-                Token::Match(tok1, "using namespace %name% ;|::")) {
+            if ((Token::Match(tok1, MATCH_PATTERN("{|}|namespace|class|struct|union")) && tok1->strAt(-1) != "using") ||
+                Token::Match(tok1, MATCH_PATTERN("using namespace %name% ;|::"))) {
                 try {
                     setScopeInfo(tok1, currentScope1, mSettings.debugwarnings);
                 } catch (const std::runtime_error &) {
@@ -3187,7 +3188,7 @@ bool Tokenizer::simplifyUsing()
             }
 
             // skip template definitions
-            if (Token::Match(tok1, "template < !!>")) {
+            if (Token::Match(tok1, MATCH_PATTERN("template < !!>"))) {
                 Token *declEndToken = TemplateSimplifier::findTemplateDeclarationEnd(tok1);
                 if (declEndToken)
                     tok1 = declEndToken;
@@ -3573,14 +3574,13 @@ bool Tokenizer::simplifyTokens1(const std::string &configuration, int fileIndex)
         Summaries::create(*this, configuration, fileIndex);
 
     // TODO: apply this through Settings::ValueFlowOptions
-    // TODO: do not run valueflow if no checks are being performed at all - e.g. unusedFunctions only
     // TODO: log message when this is active?
     const char* disableValueflowEnv = std::getenv("DISABLE_VALUEFLOW");
-    const bool doValueFlow = !disableValueflowEnv || (std::strcmp(disableValueflowEnv, "1") != 0);
+    const bool doValueFlow = (!disableValueflowEnv || (std::strcmp(disableValueflowEnv, "1") != 0)) && !mValueFlowProducts.empty();
 
     if (doValueFlow) {
         Timer::run("Tokenizer::simplifyTokens1::ValueFlow", mTimerResults, [&]() {
-            ValueFlow::setValues(list, *mSymbolDatabase, mErrorLogger, mSettings, mTimerResults);
+            ValueFlow::setValues(list, *mSymbolDatabase, mErrorLogger, mSettings, mTimerResults, mValueFlowProducts);
         });
 
         arraySizeAfterValueFlow();
@@ -8525,14 +8525,14 @@ void Tokenizer::validate() const
     const Token *lastTok = nullptr;
     for (const Token *tok = tokens(); tok; tok = tok->next()) {
         lastTok = tok;
-        if (Token::Match(tok, "[{([]") || (tok->str() == "<" && tok->link())) {
+        if (Token::Match(tok, MATCH_PATTERN("[{([]")) || (tok->str() == "<" && tok->link())) {
             if (tok->link() == nullptr)
                 cppcheckError(tok);
 
             linkTokens.push(tok);
         }
 
-        else if (Token::Match(tok, "[})]]") || (Token::Match(tok, ">|>>") && tok->link())) {
+        else if (Token::Match(tok, MATCH_PATTERN("[})]]")) || (Token::Match(tok, MATCH_PATTERN(">|>>")) && tok->link())) {
             if (tok->link() == nullptr)
                 cppcheckError(tok);
 
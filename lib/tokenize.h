@@ -30,6 +30,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 class Settings;
@@ -39,6 +40,9 @@ class Token;
 class TemplateSimplifier;
 class ErrorLogger;
 struct Directive;
+namespace ValueFlow {
+    enum class Product : std::uint8_t;
+}
 enum class Severity : std::uint8_t;
 
 /// @addtogroup Core
@@ -57,6 +61,11 @@ public:
         mTimerResults = tr;
     }
 
+    /** Set what is needed from the ValueFlow analysis. By default everything is produced. */
+    void setValueFlowProducts(std::set<ValueFlow::Product> products) {
+        mValueFlowProducts = std::move(products);
+    }
+
     /** Is the code C. Used for bailouts */
     bool isC() const {
         return list.isC();
@@ -722,6 +731,9 @@ private:
      * timer results
      */
     TimerResultsIntf* mTimerResults{};
+
+    /** What is needed from the ValueFlow analysis */
+    std::set<ValueFlow::Product> mValueFlowProducts;
 };
 
 /// @}
@@ -34,6 +34,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cctype>
+#include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <functional>
@@ -52,6 +53,118 @@
 static constexpr int AST_MAX_DEPTH = 150;
 
 
+void* TokenArena::allocate(std::size_t size)
+{
+    // keep every allocation aligned
+    size = (size + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+    for (std::pair<std::size_t, FreeSlot*>& freeSlots : mFreeSlots) {
+        if (freeSlots.first == size && freeSlots.second) {
+            FreeSlot* const slot = freeSlots.second;
+            freeSlots.second = slot->next;
+            return slot;
+        }
+    }
+
+    if (static_cast<std::size_t>(mEnd - mPos) < size) {
+        const std::size_t blockSize = size > BLOCK_SIZE ? size : BLOCK_SIZE;
+        mBlocks.emplace_back(new char[blockSize]);
+        mReservedBytes += blockSize;
+        mPos = mBlocks.back().get();
+        mEnd = mPos + blockSize;
+    }
+    void* const p = mPos;
+    mPos += size;
+    return p;
+}
+
+void TokenArena::deallocate(void* p, std::size_t size)
+{
+    size = (size + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+    auto* const slot = static_cast<FreeSlot*>(p);
+    for (std::pair<std::size_t, FreeSlot*>& freeSlots : mFreeSlots) {
+        if (freeSlots.first == size) {
+            slot->next = freeSlots.second;
+            freeSlots.second = slot;
+            return;
+        }
+    }
+    slot->next = nullptr;
+    mFreeSlots.emplace_back(size, slot);
+}
+
+//---------------------------------------------------------------------------
+
+namespace {
+    /** The keywords and punctuators of all standards with their fixed ids */
+    struct FixedTokenStrings {
+        FixedTokenStrings() {
+            add("");
+
+            static const char * const punctuators[] = {
+                ";", ",", "(", ")", "{", "}", "[", "]", "<", ">", ".", "->", "::", ":", "?", "=",
+                "==", "!=", "<=", ">=", "<=>", "+", "-", "*", "/", "%", "&", "|", "^", "~", "!",
+                "&&", "||", "<<", ">>", "++", "--", "+=", "-=", "*=", "/=", "%=", "&=", "|=", "^=",
+                "<<=", ">>=", "...", "#", "##", ".*", "->*"
+            };
+            for (const char *punctuator : punctuators)
+                add(punctuator);
+
+            // sorted so the ids do not depend on the order in the hash sets
+            std::set<std::string> keywords(Keywords::getAll(Standards::CLatest).cbegin(), Keywords::getAll(Standards::CLatest).cend());
+            keywords.insert(Keywords::getAll(Standards::CPPLatest).cbegin(), Keywords::getAll(Standards::CPPLatest).cend());
+            for (const std::string &keyword : keywords)
+                add(keyword);
+        }
+
+        void add(const std::string &s) {
+            maxLength = std::max(maxLength, s.size());
+            strings.emplace(s, static_cast<std::uint32_t>(strings.size()));
+        }
+
+        std::unordered_map<std::string, std::uint32_t> strings;
+        std::size_t maxLength{};
+    };
+}
+
+static const FixedTokenStrings& getFixedTokenStrings()
+{
+    static const FixedTokenStrings fixedTokenStrings;
+    return fixedTokenStrings;
+}
+
+const TokenStrings::Entry* TokenStrings::getEmpty()
+{
+    static const Entry* const empty = &*getFixedTokenStrings().strings.find("");
+    return empty;
+}
+
+const TokenStrings::Entry* TokenStrings::getFixed(const std::string& s)
+{
+    const FixedTokenStrings& fixed = getFixedTokenStrings();
+    // names, numbers and literals are most common, avoid the lookup for the ones which cannot be fixed
+    if (s.size() > fixed.maxLength || (!s.empty() && (std::isdigit(static_cast<unsigned char>(s[0])) || s[0] == '\'' || s[0] == '"')))
+        return nullptr;
+    const auto it = fixed.strings.find(s);
+    return it == fixed.strings.cend() ? nullptr : &*it;
+}
+
+const TokenStrings::Entry* TokenStrings::intern(const std::string& s)
+{
+    if (const Entry* const fixed = getFixed(s))
+        return fixed;
+    auto it = mStrings.find(s);
+    if (it == mStrings.end()) {
+        // the ids of the other strings follow the fixed ids
+        const std::size_t id = getFixedTokenStrings().strings.size() + mStrings.size();
+        it = mStrings.emplace(s, static_cast<std::uint32_t>(id)).first;
+    }
+    return &*it;
+}
+
+//---------------------------------------------------------------------------
+
 TokenList::TokenList(const Settings& settings, Standards::Language lang)
     : mTokensFrontBack(new TokensFrontBack)
     , mSettings(settings)
@@ -119,7 +232,7 @@ void TokenList::deleteTokens(Token *tok)
 {
     while (tok) {
         Token *next = tok->next();
-        delete tok;
+        Token::destroy(tok);
         tok = next;
     }
 }
@@ -151,7 +264,7 @@ void TokenList::addtoken(const std::string& str, const nonneg int lineno, const
     if (mTokensFrontBack->back) {
         mTokensFrontBack->back->insertToken(str);
     } else {
-        mTokensFrontBack->front = new Token(*this, mTokensFrontBack);
+        mTokensFrontBack->front = Token::create(*this, mTokensFrontBack);
         mTokensFrontBack->back = mTokensFrontBack->front;
         mTokensFrontBack->back->str(str);
     }
@@ -169,7 +282,7 @@ void TokenList::addtoken(const std::string& str, const Token *locationTok)
     if (mTokensFrontBack->back) {
         mTokensFrontBack->back->insertToken(str);
     } else {
-        mTokensFrontBack->front = new Token(*this, mTokensFrontBack);
+        mTokensFrontBack->front = Token::create(*this, mTokensFrontBack);
         mTokensFrontBack->back = mTokensFrontBack->front;
         mTokensFrontBack->back->str(str);
     }
@@ -187,7 +300,7 @@ void TokenList::addtoken(const Token * tok, const nonneg int lineno, const nonne
     if (mTokensFrontBack->back) {
         mTokensFrontBack->back->insertToken(tok->str(), tok->originalName());
     } else {
-        mTokensFrontBack->front = new Token(*this, mTokensFrontBack);
+        mTokensFrontBack->front = Token::create(*this, mTokensFrontBack);
         mTokensFrontBack->back = mTokensFrontBack->front;
         mTokensFrontBack->back->str(tok->str());
         if (!tok->originalName().empty())
@@ -209,7 +322,7 @@ void TokenList::addtoken(const Token *tok, const Token *locationTok)
     if (mTokensFrontBack->back) {
         mTokensFrontBack->back->insertToken(tok->str(), tok->originalName());
     } else {
-        mTokensFrontBack->front = new Token(*this, mTokensFrontBack);
+        mTokensFrontBack->front = Token::create(*this, mTokensFrontBack);
         mTokensFrontBack->back = mTokensFrontBack->front;
         mTokensFrontBack->back->str(tok->str());
         if (!tok->originalName().empty())
@@ -231,7 +344,7 @@ void TokenList::addtoken(const Token *tok)
     if (mTokensFrontBack->back) {
         mTokensFrontBack->back->insertToken(tok->str(), tok->originalName(), tok->getMacroName());
     } else {
-        mTokensFrontBack->front = new Token(*this, mTokensFrontBack);
+        mTokensFrontBack->front = Token::create(*this, mTokensFrontBack);
         mTokensFrontBack->back = mTokensFrontBack->front;
         mTokensFrontBack->back->str(tok->str());
         if (!tok->originalName().empty())
@@ -391,7 +504,7 @@ void TokenList::createTokens(simplecpp::TokenList&& tokenList)
         if (mTokensFrontBack->back) {
             mTokensFrontBack->back->insertToken(str);
         } else {
-            mTokensFrontBack->front = new Token(*this, mTokensFrontBack);
+            mTokensFrontBack->front = Token::create(*this, mTokensFrontBack);
             mTokensFrontBack->back = mTokensFrontBack->front;
             mTokensFrontBack->back->str(str);
         }
@@ -27,10 +27,14 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 class Token;
+class Scope;
 class Settings;
 
 namespace simplecpp {
@@ -41,11 +45,96 @@ namespace simplecpp {
 /// @{
 
 /**
- * @brief This struct stores pointers to the front and back tokens of the list this token is in.
+ * @brief Allocates the memory of the tokens of a list in large blocks.
+ * Released memory is reused for the next allocation of the same size. The blocks are
+ * only freed all at once when the arena is destroyed.
+ */
+class CPPCHECKLIB TokenArena {
+public:
+    TokenArena() = default;
+    TokenArena(const TokenArena &) = delete;
+    TokenArena &operator=(const TokenArena &) = delete;
+
+    void* allocate(std::size_t size);
+    void deallocate(void* p, std::size_t size);
+
+    /** @return the number of bytes in the allocated blocks */
+    std::size_t getReservedBytes() const {
+        return mReservedBytes;
+    }
+
+private:
+    static constexpr std::size_t BLOCK_SIZE = 64 * 1024;
+
+    struct FreeSlot {
+        FreeSlot* next;
+    };
+
+    /** released memory per size, there are only a few different sizes */
+    std::vector<std::pair<std::size_t, FreeSlot*>> mFreeSlots;
+
+    std::vector<std::unique_ptr<char[]>> mBlocks;
+    std::size_t mReservedBytes{};
+    char* mPos{};
+    char* mEnd{};
+};
+
+/**
+ * @brief The strings of the tokens of a list. Every distinct string is stored only once and the
+ * tokens point at its entry. The keywords and punctuators have fixed ids which are the same in all
+ * lists. The other strings get ids which are only unique within their list.
+ */
+class CPPCHECKLIB TokenStrings {
+public:
+    /** A string and its id */
+    using Entry = std::pair<const std::string, std::uint32_t>;
+
+    TokenStrings() = default;
+    TokenStrings(const TokenStrings &) = delete;
+    TokenStrings &operator=(const TokenStrings &) = delete;
+
+    /** @return the entry of the string, it is added if it does not exist yet */
+    const Entry* intern(const std::string& s);
+
+    /** @return the number of the strings which are stored in this list */
+    std::size_t size() const {
+        return mStrings.size();
+    }
+
+    /** @return the entry of the empty string, its id is 0 */
+    static const Entry* getEmpty();
+
+    /** @return the entry of a keyword or punctuator or nullptr if the string has no fixed id */
+    static const Entry* getFixed(const std::string& s);
+
+private:
+    std::unordered_map<std::string, std::uint32_t> mStrings;
+};
+
+/**
+ * @brief This struct stores pointers to the front and back tokens of the list this token is in
+ * and counts the changes of their values. It also owns the memory and the strings of the tokens.
  */
 struct TokensFrontBack {
     Token *front{};
     Token* back{};
+    /** the memory of the tokens, see Token::create() */
+    TokenArena arena;
+    /** the strings of the tokens */
+    TokenStrings strings;
+    /** number of changes of the token values, see Token::addValue() */
+    std::size_t valueChanges{};
+    /** number of changes of the token values per scope of the tokens */
+    std::unordered_map<const Scope*, std::size_t> scopeValueChanges;
+
+    /** the values of the tokens of different functions might be changed simultaneously (--function-jobs) */
+    std::mutex valueChangesSync;
+
+    void valueChanged(const Scope* scope) {
+        std::lock_guard<std::mutex> lg(valueChangesSync);
+        ++valueChanges;
+        ++scopeValueChanges[scope];
+    }
 };
 
 class CPPCHECKLIB TokenList {
@@ -135,6 +224,16 @@ public:
         return mTokensFrontBack->back;
     }
 
+    /** get the number of times token values were added or removed */
+    std::size_t getValueChanges() const {
+        return mTokensFrontBack->valueChanges;
+    }
+
+    /** get the number of times token values were added or removed per scope of the tokens */
+    const std::unordered_map<const Scope*, std::size_t>& getScopeValueChanges() const {
+        return mTokensFrontBack->scopeValueChanges;
+    }
+
     /**
      * Get filenames (the sourcefile + the files it include).
      * The first filename is the filename for the sourcefile
@@ -111,11 +111,14 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <chrono>
 #include <cstdint>
 #include <cstring>
+#include <exception>
 #include <functional>
+#include <future>
 #include <initializer_list>
 #include <iterator>
 #include <limits>
@@ -159,7 +162,7 @@ static void bailoutInternal(const std::string& type,
 #define bailoutIncompleteVar(tokenlist, errorLogger, tok, what)                                                        \
     bailoutInternal("valueFlowBailoutIncompleteVar", (tokenlist), (errorLogger), (tok), (what), "", 0, __func__)
 
-static void changeKnownToPossible(std::list<ValueFlow::Value>& values, int indirect = -1)
+static void changeKnownToPossible(std::vector<ValueFlow::Value>& values, int indirect = -1)
 {
     for (ValueFlow::Value& v : values) {
         if (indirect >= 0 && v.indirect != indirect)
@@ -168,22 +171,22 @@ static void changeKnownToPossible(std::list<ValueFlow::Value>& values, int indir
     }
 }
 
-static void removeImpossible(std::list<ValueFlow::Value>& values, int indirect = -1)
+static void removeImpossible(std::vector<ValueFlow::Value>& values, int indirect = -1)
 {
-    values.remove_if([&](const ValueFlow::Value& v) {
+    values.erase(std::remove_if(values.begin(), values.end(), [&](const ValueFlow::Value& v) {
         if (indirect >= 0 && v.indirect != indirect)
             return false;
         return v.isImpossible();
-    });
+    }), values.end());
 }
 
-static void lowerToPossible(std::list<ValueFlow::Value>& values, int indirect = -1)
+static void lowerToPossible(std::vector<ValueFlow::Value>& values, int indirect = -1)
 {
     changeKnownToPossible(values, indirect);
     removeImpossible(values, indirect);
 }
 
-static void changePossibleToKnown(std::list<ValueFlow::Value>& values, int indirect = -1)
+static void changePossibleToKnown(std::vector<ValueFlow::Value>& values, int indirect = -1)
 {
     for (ValueFlow::Value& v : values) {
         if (indirect >= 0 && v.indirect != indirect)
@@ -748,7 +751,7 @@ static void valueFlowArrayElement(TokenList& tokenlist, const Settings& settings
         if (Token::simpleMatch(tok, "[") && tok->isBinaryOp()) {
             indexTok = tok->astOperand2();
             arrayTok = tok->astOperand1();
-        } else if (Token::Match(tok->tokAt(-2), ". %name% (") && astIsContainer(tok->tokAt(-2)->astOperand1())) {
+        } else if (Token::Match(tok->tokAt(-2), MATCH_PATTERN(". %name% (")) && astIsContainer(tok->tokAt(-2)->astOperand1())) {
             arrayTok = tok->tokAt(-2)->astOperand1();
             const Library::Container* container = getLibraryContainer(arrayTok);
             if (!container || container->stdAssociativeLike)
@@ -784,12 +787,8 @@ static void valueFlowArrayElement(TokenList& tokenlist, const Settings& settings
                 if (arrayValue.valueKind == indexValue.valueKind)
                     result.valueKind = arrayValue.valueKind;
 
-                result.errorPath.insert(result.errorPath.end(),
-                                        arrayValue.errorPath.cbegin(),
-                                        arrayValue.errorPath.cend());
-                result.errorPath.insert(result.errorPath.end(),
-                                        indexValue.errorPath.cbegin(),
-                                        indexValue.errorPath.cend());
+                result.errorPath.append(arrayValue.errorPath);
+                result.errorPath.append(indexValue.errorPath);
 
                 const MathLib::bigint index = indexValue.intvalue;
 
@@ -810,7 +809,7 @@ static void valueFlowArrayElement(TokenList& tokenlist, const Settings& settings
                     const ValueFlow::Value* v = arg->getKnownValue(ValueFlow::Value::ValueType::INT);
                     if (v) {
                         result.intvalue = v->intvalue;
-                        result.errorPath.insert(result.errorPath.end(), v->errorPath.cbegin(), v->errorPath.cend());
+                        result.errorPath.append(v->errorPath);
                         setTokenValue(tok, std::move(result), settings);
                     }
                 }
@@ -910,7 +909,9 @@ static void valueFlowSameExpressions(TokenList& tokenlist, const Settings& setti
         ValueFlow::Value value(val);
         value.setKnown();
 
-        if (isSameExpression(false, tok->astOperand1(), tok->astOperand2(), settings, true, true, &value.errorPath)) {
+        ErrorPath errorPath;
+        if (isSameExpression(false, tok->astOperand1(), tok->astOperand2(), settings, true, true, &errorPath)) {
+            value.errorPath.append(errorPath);
             setTokenValue(tok, std::move(value), settings);
         }
     }
@@ -1071,9 +1072,9 @@ static void valueFlowImpossibleValues(TokenList& tokenList, const Settings& sett
     for (Token* tok = tokenList.front(); tok; tok = tok->next()) {
         if (tok->hasKnownIntValue())
             continue;
-        if (Token::Match(tok, "%bool%"))
+        if (Token::Match(tok, MATCH_PATTERN("%bool%")))
             continue;
-        if (astIsBool(tok) || Token::Match(tok, "%comp%")) {
+        if (astIsBool(tok) || Token::Match(tok, MATCH_PATTERN("%comp%"))) {
             ValueFlow::Value lower{-1};
             lower.bound = ValueFlow::Value::Bound::Upper;
             lower.setImpossible();
@@ -1140,12 +1141,12 @@ static void valueFlowImpossibleValues(TokenList& tokenList, const Settings& sett
             value.bound = ValueFlow::Value::Bound::Lower;
             value.setImpossible();
             setTokenValue(tok, std::move(value), settings);
-        } else if (Token::Match(tok, "abs|labs|llabs|fabs|fabsf|fabsl (")) {
+        } else if (Token::Match(tok, MATCH_PATTERN("abs|labs|llabs|fabs|fabsf|fabsl ("))) {
             ValueFlow::Value value{-1};
             value.bound = ValueFlow::Value::Bound::Upper;
             value.setImpossible();
             setTokenValue(tok->next(), std::move(value), settings);
-        } else if (Token::Match(tok, ". data|c_str (") && astIsContainerOwned(tok->astOperand1())) {
+        } else if (Token::Match(tok, MATCH_PATTERN(". data|c_str (")) && astIsContainerOwned(tok->astOperand1())) {
             const Library::Container* container = getLibraryContainer(tok->astOperand1());
             if (!container)
                 continue;
@@ -1156,7 +1157,7 @@ static void valueFlowImpossibleValues(TokenList& tokenList, const Settings& sett
             ValueFlow::Value value{0};
             value.setImpossible();
             setTokenValue(tok->tokAt(2), std::move(value), settings);
-        } else if (Token::Match(tok, "make_shared|make_unique <") && Token::simpleMatch(tok->linkAt(1), "> (")) {
+        } else if (Token::Match(tok, MATCH_PATTERN("make_shared|make_unique <")) && Token::simpleMatch(tok->linkAt(1), "> (")) {
             ValueFlow::Value value{0};
             value.setImpossible();
             setTokenValue(tok->linkAt(1)->next(), std::move(value), settings);
@@ -1302,7 +1303,7 @@ static Analyzer::Result valueFlowForward(Token* startToken,
 static Analyzer::Result valueFlowForward(Token* startToken,
                                          const Token* endToken,
                                          const Token* exprTok,
-                                         std::list<ValueFlow::Value> values,
+                                         std::vector<ValueFlow::Value> values,
                                          const TokenList& tokenlist,
                                          ErrorLogger& errorLogger,
                                          const Settings& settings,
@@ -1334,7 +1335,7 @@ static Analyzer::Result valueFlowForward(Token* startToken,
 
 static Analyzer::Result valueFlowForwardRecursive(Token* top,
                                                   const Token* exprTok,
-                                                  std::list<ValueFlow::Value> values,
+                                                  std::vector<ValueFlow::Value> values,
                                                   const TokenList& tokenlist,
                                                   ErrorLogger& errorLogger,
                                                   const Settings& settings,
@@ -1353,7 +1354,7 @@ static Analyzer::Result valueFlowForwardRecursive(Token* top,
 static void valueFlowReverse(Token* tok,
                              const Token* const endToken,
                              const Token* const varToken,
-                             std::list<ValueFlow::Value> values,
+                             std::vector<ValueFlow::Value> values,
                              const TokenList& tokenlist,
                              ErrorLogger& errorLogger,
                              const Settings& settings,
@@ -1647,7 +1648,7 @@ static std::vector<ValueFlow::LifetimeToken> getLifetimeTokens(const Token* tok,
                     continue;
                 if (v.tokvalue == tok)
                     continue;
-                errorPath.insert(errorPath.end(), v.errorPath.cbegin(), v.errorPath.cend());
+                errorPath.splice(errorPath.end(), v.errorPath.toList());
                 return ValueFlow::LifetimeToken::setAddressOf(
                     getLifetimeTokens(v.tokvalue, escape, std::move(errorPath), pred, settings, depth - 1),
                     false);
@@ -1985,8 +1986,8 @@ static void valueFlowForwardLifetime(Token * tok, const TokenList &tokenlist, Er
 {
     // Forward lifetimes to constructed variable
     if (Token::Match(tok->previous(), "%var% {|(") && isVariableDecl(tok->previous())) {
-        std::list<ValueFlow::Value> values = tok->values();
-        values.remove_if(&isNotLifetimeValue);
+        std::vector<ValueFlow::Value> values = tok->values();
+        values.erase(std::remove_if(values.begin(), values.end(), &isNotLifetimeValue), values.end());
         valueFlowForward(nextAfterAstRightmostLeaf(tok), ValueFlow::getEndOfExprScope(tok), tok->previous(), std::move(values), tokenlist, errorLogger, settings);
         return;
     }
@@ -2014,14 +2015,14 @@ static void valueFlowForwardLifetime(Token * tok, const TokenList &tokenlist, Er
         const Token* endOfVarScope = ValueFlow::getEndOfExprScope(expr);
 
         // Only forward lifetime values
-        std::list<ValueFlow::Value> values = parent->astOperand2()->values();
-        values.remove_if(&isNotLifetimeValue);
+        std::vector<ValueFlow::Value> values = parent->astOperand2()->values();
+        values.erase(std::remove_if(values.begin(), values.end(), &isNotLifetimeValue), values.end());
         // Dont forward lifetimes that overlap
-        values.remove_if([&](const ValueFlow::Value& value) {
+        values.erase(std::remove_if(values.begin(), values.end(), [&](const ValueFlow::Value& value) {
             return findAstNode(value.tokvalue, [&](const Token* child) {
                 return child->exprId() == expr->exprId();
             });
-        });
+        }), values.end());
 
         // Skip RHS
         Token* nextExpression = nextAfterAstRightmostLeaf(parent);
@@ -2049,16 +2050,16 @@ static void valueFlowForwardLifetime(Token * tok, const TokenList &tokenlist, Er
         const Variable *var = tok->variable();
         const Token *endOfVarScope = var->scope()->bodyEnd;
 
-        std::list<ValueFlow::Value> values = tok->values();
+        std::vector<ValueFlow::Value> values = tok->values();
         Token *nextExpression = nextAfterAstRightmostLeaf(parent);
         // Only forward lifetime values
-        values.remove_if(&isNotLifetimeValue);
+        values.erase(std::remove_if(values.begin(), values.end(), &isNotLifetimeValue), values.end());
         valueFlowForward(nextExpression, endOfVarScope, tok, std::move(values), tokenlist, errorLogger, settings);
         // Cast
     } else if (parent->isCast()) {
-        std::list<ValueFlow::Value> values = tok->values();
+        std::vector<ValueFlow::Value> values = tok->values();
         // Only forward lifetime values
-        values.remove_if(&isNotLifetimeValue);
+        values.erase(std::remove_if(values.begin(), values.end(), &isNotLifetimeValue), values.end());
         for (ValueFlow::Value& value:values)
             setTokenValue(parent, std::move(value), settings);
         valueFlowForwardLifetime(parent, tokenlist, errorLogger, settings);
@@ -2239,7 +2240,7 @@ struct LifetimeStore {
                     return false;
                 if (!pred(lt.token))
                     return false;
-                ErrorPath er = v.errorPath;
+                ErrorPath er = v.errorPath.toList();
                 er.insert(er.end(), lt.errorPath.cbegin(), lt.errorPath.cend());
                 er.emplace_back(argtok, message);
                 er.insert(er.end(), errorPath.cbegin(), errorPath.cend());
@@ -2303,7 +2304,7 @@ struct LifetimeStore {
             if (!v.isLifetimeValue())
                 continue;
             const Token *tok2 = v.tokvalue;
-            ErrorPath er = v.errorPath;
+            ErrorPath er = v.errorPath.toList();
             const Variable *var = ValueFlow::getLifetimeVariable(tok2, er, settings);
             // TODO: the inserted data is never used
             er.insert(er.end(), errorPath.cbegin(), errorPath.cend());
@@ -2563,7 +2564,7 @@ static void valueFlowLifetimeFunction(Token *tok, const TokenList &tokenlist, Er
                                                      ValueFlow::Value::LifetimeKind::Object};
                     ls.inconclusive = inconclusive;
                     ls.forward = false;
-                    ls.errorPath = v.errorPath;
+                    ls.errorPath = v.errorPath.toList();
                     ls.errorPath.emplace_front(returnTok, "Return " + lifetimeType(returnTok, &v) + ".");
                     int thisIndirect = v.lifetimeScope == ValueFlow::Value::LifetimeScope::ThisValue ? 0 : 1;
                     if (derefShared(memtok->astParent()))
@@ -2582,7 +2583,7 @@ static void valueFlowLifetimeFunction(Token *tok, const TokenList &tokenlist, Er
                     continue;
                 ls.forward = false;
                 ls.inconclusive = inconclusive;
-                ls.errorPath = v.errorPath;
+                ls.errorPath = v.errorPath.toList();
                 ls.errorPath.emplace_front(returnTok, "Return " + lifetimeType(returnTok, &v) + ".");
                 if (!v.isArgumentLifetimeValue() && (var->isReference() || var->isRValueReference())) {
                     update |= ls.byRef(tok->next(), tokenlist, errorLogger, settings);
@@ -3120,7 +3121,7 @@ static void valueFlowLifetime(TokenList &tokenlist, ErrorLogger &errorLogger, co
                 for (const ReferenceToken& rt : tok2->refs(false)) {
                     ValueFlow::Value value = master;
                     value.tokvalue = rt.token;
-                    value.errorPath.insert(value.errorPath.begin(), rt.errors.cbegin(), rt.errors.cend());
+                    value.errorPath.prepend(rt.errors);
                     if (Token::simpleMatch(parent, "("))
                         setTokenValue(parent, std::move(value), settings);
                     else
@@ -3128,7 +3129,7 @@ static void valueFlowLifetime(TokenList &tokenlist, ErrorLogger &errorLogger, co
 
                     if (!rt.token->variable()) {
                         LifetimeStore ls = LifetimeStore{
-                            rt.token, master.errorPath.back().second, ValueFlow::Value::LifetimeKind::Object};
+                            rt.token, master.errorPath.backInfo(), ValueFlow::Value::LifetimeKind::Object};
                         ls.byRef(parent->tokAt(2), tokenlist, errorLogger, settings);
                     }
                 }
@@ -3136,11 +3137,11 @@ static void valueFlowLifetime(TokenList &tokenlist, ErrorLogger &errorLogger, co
             valueFlowForwardLifetime(parent->tokAt(2), tokenlist, errorLogger, settings);
         }
         // Check constructors
-        else if (Token::Match(tok, "=|return|%name%|{|,|> {") && !isScope(tok->next())) {
+        else if (Token::Match(tok, MATCH_PATTERN("=|return|%name%|{|,|> {")) && !isScope(tok->next())) {
             valueFlowLifetimeConstructor(tok->next(), tokenlist, errorLogger, settings);
         }
         // Check function calls
-        else if (Token::Match(tok, "%name% (") && !Token::simpleMatch(tok->linkAt(1), ") {")) {
+        else if (Token::Match(tok, MATCH_PATTERN("%name% (")) && !Token::simpleMatch(tok->linkAt(1), ") {")) {
             valueFlowLifetimeFunction(tok, tokenlist, errorLogger, settings);
         }
         // Unique pointer lifetimes
@@ -3871,19 +3872,17 @@ static void valueFlowForwardConst(Token* start,
                     for (ValueFlow::Value value : values) {
                         if (refs.size() > 1)
                             value.setInconclusive();
-                        value.errorPath.insert(value.errorPath.end(), it->errors.cbegin(), it->errors.cend());
+                        value.errorPath.append(it->errors);
                         setTokenValue(tok, std::move(value), settings);
                     }
                     return;
                 }
-                // Follow symbolic values
-                for (const ValueFlow::Value& v : tok->values()) {
-                    if (!v.isSymbolicValue())
-                        continue;
-                    if (!v.tokvalue)
-                        continue;
-                    if (v.tokvalue->varId() != var->declarationId())
-                        continue;
+                // Follow symbolic values, setTokenValue() below changes the values of tok
+                std::vector<ValueFlow::Value> symValues;
+                std::copy_if(tok->values().cbegin(), tok->values().cend(), std::back_inserter(symValues), [&](const ValueFlow::Value& v) {
+                    return v.isSymbolicValue() && v.tokvalue && v.tokvalue->varId() == var->declarationId();
+                });
+                for (const ValueFlow::Value& v : symValues) {
                     for (ValueFlow::Value value : values) {
                         if (!v.isKnown() && value.isImpossible())
                             continue;
@@ -3895,7 +3894,7 @@ static void valueFlowForwardConst(Token* start,
                         if (!value.isImpossible())
                             value.valueKind = v.valueKind;
                         value.bound = v.bound;
-                        value.errorPath.insert(value.errorPath.end(), v.errorPath.cbegin(), v.errorPath.cend());
+                        value.errorPath.append(v.errorPath);
                         setTokenValue(tok, std::move(value), settings);
                     }
                 }
@@ -3956,7 +3955,7 @@ static bool isInitialVarAssign(const Token* tok)
 static void valueFlowForwardAssign(Token* const tok,
                                    const Token* expr,
                                    std::vector<const Variable*> vars,
-                                   std::list<ValueFlow::Value> values,
+                                   std::vector<ValueFlow::Value> values,
                                    const bool init,
                                    const TokenList& tokenlist,
                                    ErrorLogger& errorLogger,
@@ -3967,13 +3966,13 @@ static void valueFlowForwardAssign(Token* const tok,
     const Token* endOfVarScope = ValueFlow::getEndOfExprScope(expr);
     if (std::any_of(values.cbegin(), values.cend(), std::mem_fn(&ValueFlow::Value::isLifetimeValue))) {
         valueFlowForwardLifetime(tok, tokenlist, errorLogger, settings);
-        values.remove_if(std::mem_fn(&ValueFlow::Value::isLifetimeValue));
+        values.erase(std::remove_if(values.begin(), values.end(), std::mem_fn(&ValueFlow::Value::isLifetimeValue)), values.end());
     }
     if (std::all_of(
             vars.cbegin(), vars.cend(), [&](const Variable* var) {
         return !var->isPointer() && !var->isSmartPointer();
     }))
-        values.remove_if(std::mem_fn(&ValueFlow::Value::isTokValue));
+        values.erase(std::remove_if(values.begin(), values.end(), std::mem_fn(&ValueFlow::Value::isTokValue)), values.end());
     if (tok->astParent()) {
         for (ValueFlow::Value& value : values) {
             std::string valueKind;
@@ -4038,8 +4037,8 @@ static void valueFlowForwardAssign(Token* const tok,
                 return true;
             return false;
         });
-        std::list<ValueFlow::Value> constValues;
-        constValues.splice(constValues.end(), values, it, values.end());
+        std::vector<ValueFlow::Value> constValues(std::make_move_iterator(it), std::make_move_iterator(values.end()));
+        values.erase(it, values.end());
         valueFlowForwardConst(nextExpression, endOfVarScope, expr->variable(), constValues, settings);
     }
     if (isInitialVarAssign(expr)) {
@@ -4065,7 +4064,7 @@ static void valueFlowForwardAssign(Token* const tok,
 
 static void valueFlowForwardAssign(Token* const tok,
                                    const Variable* const var,
-                                   const std::list<ValueFlow::Value>& values,
+                                   const std::vector<ValueFlow::Value>& values,
                                    const bool /*unused*/,
                                    const bool init,
                                    const TokenList& tokenlist,
@@ -4075,7 +4074,7 @@ static void valueFlowForwardAssign(Token* const tok,
     valueFlowForwardAssign(tok, var->nameToken(), {var}, values, init, tokenlist, errorLogger, settings);
 }
 
-static std::list<ValueFlow::Value> truncateValues(std::list<ValueFlow::Value> values,
+static std::vector<ValueFlow::Value> truncateValues(std::vector<ValueFlow::Value> values,
                                                   const ValueType* dst,
                                                   const ValueType* src,
                                                   const Settings& settings)
@@ -4088,7 +4087,7 @@ static std::list<ValueFlow::Value> truncateValues(std::list<ValueFlow::Value> va
     if (src) {
         const size_t osz = src->getSizeOf(settings, ValueType::Accuracy::ExactOrZero, ValueType::SizeOf::Pointer);
         if (osz >= sz && dst->sign == ValueType::Sign::SIGNED && src->sign == ValueType::Sign::UNSIGNED) {
-            values.remove_if([&](const ValueFlow::Value& value) {
+            values.erase(std::remove_if(values.begin(), values.end(), [&](const ValueFlow::Value& value) {
                 if (!value.isIntValue())
                     return false;
                 if (!value.isImpossible())
@@ -4100,7 +4099,7 @@ static std::list<ValueFlow::Value> truncateValues(std::list<ValueFlow::Value> va
                 if (osz > sz)
                     return true;
                 return false;
-            });
+            }), values.end());
         }
     }
 
@@ -4158,15 +4157,124 @@ static bool intersects(const C1& c1, const C2& c2)
     return false;
 }
 
+namespace {
+    /** Buffers what is reported while a function is analyzed so it can be reported in the order of the functions */
+    class FunctionScopeLogger : public ErrorLogger
+    {
+    public:
+        void reportOut(const std::string &outmsg, Color c) override
+        {
+            mOutput.emplace_back([=](ErrorLogger &errorLogger) {
+                errorLogger.reportOut(outmsg, c);
+            });
+        }
+
+        void reportErr(const ErrorMessage &msg) override
+        {
+            mOutput.emplace_back([=](ErrorLogger &errorLogger) {
+                errorLogger.reportErr(msg);
+            });
+        }
+
+        void reportMetric(const std::string &metric) override
+        {
+            mOutput.emplace_back([=](ErrorLogger &errorLogger) {
+                errorLogger.reportMetric(metric);
+            });
+        }
+
+        void flush(ErrorLogger &errorLogger) const
+        {
+            for (const auto &output : mOutput)
+                output(errorLogger);
+        }
+
+    private:
+        std::vector<std::function<void(ErrorLogger&)>> mOutput;
+    };
+}
+
+/**
+ * Call f for each function scope that is not skipped. With --function-jobs the functions are analyzed
+ * simultaneously. A function owns the tokens of its body so it is analyzed by the same thread as the
+ * functions it is nested in, in the same order as the serial analysis. Everything which is reported is
+ * reported in the order of the functions.
+ */
+static void forEachFunctionScope(const SymbolDatabase& symboldatabase,
+                                 ErrorLogger& errorLogger,
+                                 const Settings& settings,
+                                 const std::set<const Scope*>& skippedFunctions,
+                                 const std::function<void(const Scope* scope, ErrorLogger& errorLogger)>& f)
+{
+    const std::vector<const Scope*>& functionScopes = symboldatabase.functionScopes;
+#ifdef HAS_THREADING_MODEL_THREAD
+    if (settings.vfOptions.functionJobs > 1 && functionScopes.size() > 1) {
+        // group the functions by the outermost function they are nested in
+        std::vector<std::vector<std::size_t>> groups;
+        std::unordered_map<const Scope*, std::size_t> groupIndex;
+        for (std::size_t i = 0; i < functionScopes.size(); ++i) {
+            if (skippedFunctions.count(functionScopes[i]))
+                continue;
+            const Scope* outermost = functionScopes[i];
+            for (const Scope* scope = outermost->nestedIn; scope; scope = scope->nestedIn) {
+                if (scope->type == ScopeType::eFunction)
+                    outermost = scope;
+            }
+            const auto it = groupIndex.emplace(outermost, groups.size());
+            if (it.second)
+                groups.emplace_back();
+            groups[it.first->second].push_back(i);
+        }
+
+        std::vector<FunctionScopeLogger> loggers(functionScopes.size());
+        std::vector<std::exception_ptr> exceptions(functionScopes.size());
+        std::atomic<std::size_t> nextGroup{0};
+        const auto threadProc = [&]() {
+            std::size_t index;
+            while ((index = nextGroup++) < groups.size()) {
+                for (const std::size_t i : groups[index]) {
+                    try {
+                        f(functionScopes[i], loggers[i]);
+                    } catch (...) {
+                        exceptions[i] = std::current_exception();
+                        break;
+                    }
+                }
+            }
+        };
+
+        std::vector<std::future<void>> threadFutures;
+        const std::size_t threadCount = std::min<std::size_t>(settings.vfOptions.functionJobs, groups.size());
+        for (std::size_t i = 1; i < threadCount; ++i)
+            threadFutures.emplace_back(std::async(std::launch::async, threadProc));
+        threadProc();
+        for (std::future<void>& future : threadFutures)
+            future.get();
+
+        for (std::size_t i = 0; i < functionScopes.size(); ++i) {
+            loggers[i].flush(errorLogger);
+            if (exceptions[i])
+                std::rethrow_exception(exceptions[i]);
+        }
+        return;
+    }
+#else
+    (void)settings;
+#endif
+    for (const Scope* scope : functionScopes) {
+        if (skippedFunctions.count(scope))
+            continue;
+        f(scope, errorLogger);
+    }
+}
+
 static void valueFlowAfterAssign(const TokenList &tokenlist,
                                  const SymbolDatabase& symboldatabase,
                                  ErrorLogger &errorLogger,
                                  const Settings &settings,
                                  const std::set<const Scope*>& skippedFunctions)
 {
-    for (const Scope * scope : symboldatabase.functionScopes) {
-        if (skippedFunctions.count(scope))
-            continue;
+    forEachFunctionScope(symboldatabase, errorLogger, settings, skippedFunctions, [&](const Scope* scope, ErrorLogger& scopeLogger) {
         std::unordered_map<nonneg int, std::unordered_set<nonneg int>> backAssigns;
         for (auto* tok = const_cast<Token*>(scope->bodyStart); tok != scope->bodyEnd; tok = tok->next()) {
             if (!tok->scope()->isExecutable()) {
@@ -4194,7 +4302,7 @@ static void valueFlowAfterAssign(const TokenList &tokenlist,
             if (!rhs || rhs->values().empty())
                 continue;
 
-            std::list<ValueFlow::Value> values = truncateValues(
+            std::vector<ValueFlow::Value> values = truncateValues(
                 rhs->values(), tok->astOperand1()->valueType(), rhs->valueType(), settings);
             // Remove known values
             std::set<ValueFlow::Value::ValueType> types;
@@ -4204,20 +4312,20 @@ static void valueFlowAfterAssign(const TokenList &tokenlist,
                         types.insert(value.valueType);
                 }
             }
-            values.remove_if([&](const ValueFlow::Value& value) {
+            values.erase(std::remove_if(values.begin(), values.end(), [&](const ValueFlow::Value& value) {
                 return types.count(value.valueType) > 0;
-            });
+            }), values.end());
             // Remove container size if its not a container
             if (!astIsContainer(tok->astOperand2()))
-                values.remove_if([&](const ValueFlow::Value& value) {
+                values.erase(std::remove_if(values.begin(), values.end(), [&](const ValueFlow::Value& value) {
                     return value.valueType == ValueFlow::Value::ValueType::CONTAINER_SIZE;
-                });
+                }), values.end());
             // Remove symbolic values that are the same as the LHS
-            values.remove_if([&](const ValueFlow::Value& value) {
+            values.erase(std::remove_if(values.begin(), values.end(), [&](const ValueFlow::Value& value) {
                 if (value.isSymbolicValue() && value.tokvalue)
                     return value.tokvalue->exprId() == tok->astOperand1()->exprId();
                 return false;
-            });
+            }), values.end());
             // Find references to LHS in RHS
             auto isIncremental = [&](const Token* tok2) -> bool {
                 return findAstNode(tok2,
@@ -4234,23 +4342,23 @@ static void valueFlowAfterAssign(const TokenList &tokenlist,
             });
             // Remove values from the same assignment if it is incremental
             if (incremental) {
-                values.remove_if([&](const ValueFlow::Value& value) {
+                values.erase(std::remove_if(values.begin(), values.end(), [&](const ValueFlow::Value& value) {
                     if (value.tokvalue)
                         return value.tokvalue == tok->astOperand2();
                     return false;
-                });
+                }), values.end());
             }
             // If assignment copy by value, remove Uninit values..
             if ((tok->astOperand1()->valueType() && tok->astOperand1()->valueType()->pointer == 0) ||
                 (tok->astOperand1()->variable() && tok->astOperand1()->variable()->isReference() && tok->astOperand1()->variable()->nameToken() == tok->astOperand1()))
-                values.remove_if([&](const ValueFlow::Value& value) {
+                values.erase(std::remove_if(values.begin(), values.end(), [&](const ValueFlow::Value& value) {
                     return value.isUninitValue();
-                });
+                }), values.end());
             if (values.empty())
                 continue;
             const bool init = vars.size() == 1 && (vars.front()->nameToken() == tok->astOperand1() || tok->isSplittedVarDeclEq());
             valueFlowForwardAssign(
-                rhs, tok->astOperand1(), std::move(vars), values, init, tokenlist, errorLogger, settings);
+                rhs, tok->astOperand1(), std::move(vars), values, init, tokenlist, scopeLogger, settings);
             // Back propagate symbolic values
             if (tok->astOperand1()->exprId() > 0) {
                 Token* start = nextAfterAstRightmostLeaf(tok);
@@ -4282,11 +4390,11 @@ static void valueFlowAfterAssign(const TokenList &tokenlist,
                     value.errorPath.emplace_back(tok,
                                                  tok->astOperand1()->expressionString() + " is assigned '" +
                                                  tok->astOperand2()->expressionString() + "' here.");
-                    valueFlowForward(start, end, expr, std::move(value), tokenlist, errorLogger, settings);
+                    valueFlowForward(start, end, expr, std::move(value), tokenlist, scopeLogger, settings);
                 }
             }
         }
-    }
+    });
 }
 
 static std::vector<const Variable*> getVariables(const Token* tok)
@@ -4320,7 +4428,7 @@ static void valueFlowAfterSwap(const TokenList& tokenlist,
                 continue;
             for (int i = 0; i < 2; i++) {
                 std::vector<const Variable*> vars = getVariables(args[0]);
-                const std::list<ValueFlow::Value>& values = args[0]->values();
+                const std::vector<ValueFlow::Value>& values = args[0]->values();
                 valueFlowForwardAssign(args[0], args[1], std::move(vars), values, false, tokenlist, errorLogger, settings);
                 std::swap(args[0], args[1]);
             }
@@ -4328,7 +4436,7 @@ static void valueFlowAfterSwap(const TokenList& tokenlist,
     }
 }
 
-static void valueFlowSetConditionToKnown(const Token* tok, std::list<ValueFlow::Value>& values, bool then)
+static void valueFlowSetConditionToKnown(const Token* tok, std::vector<ValueFlow::Value>& values, bool then)
 {
     if (values.empty())
         return;
@@ -4356,12 +4464,12 @@ ValueFlow::Value ValueFlow::asImpossible(ValueFlow::Value v)
     return v;
 }
 
-static void insertImpossible(std::list<ValueFlow::Value>& values, const std::list<ValueFlow::Value>& input)
+static void insertImpossible(std::vector<ValueFlow::Value>& values, const std::vector<ValueFlow::Value>& input)
 {
     std::transform(input.cbegin(), input.cend(), std::back_inserter(values), &ValueFlow::asImpossible);
 }
 
-static void insertNegateKnown(std::list<ValueFlow::Value>& values, const std::list<ValueFlow::Value>& input)
+static void insertNegateKnown(std::vector<ValueFlow::Value>& values, const std::vector<ValueFlow::Value>& input)
 {
     for (ValueFlow::Value value:input) {
         if (!value.isIntValue() && !value.isContainerSizeValue())
@@ -4375,8 +4483,8 @@ static void insertNegateKnown(std::list<ValueFlow::Value>& values, const std::li
 struct ConditionHandler {
     struct Condition {
         const Token* vartok{};
-        std::list<ValueFlow::Value> true_values;
-        std::list<ValueFlow::Value> false_values;
+        std::vector<ValueFlow::Value> true_values;
+        std::vector<ValueFlow::Value> false_values;
         bool inverted = false;
         // Whether to insert impossible values for the condition or only use possible values
         bool impossible = true;
@@ -4385,7 +4493,7 @@ struct ConditionHandler {
             return astIsBool(vartok);
         }
 
-        static MathLib::bigint findPath(const std::list<ValueFlow::Value>& values)
+        static MathLib::bigint findPath(const std::vector<ValueFlow::Value>& values)
         {
             auto it = std::find_if(values.cbegin(), values.cend(), [](const ValueFlow::Value& v) {
                 return v.path > 0;
@@ -4405,8 +4513,8 @@ struct ConditionHandler {
         }
 
         Token* getContextAndValues(Token* condTok,
-                                   std::list<ValueFlow::Value>& thenValues,
-                                   std::list<ValueFlow::Value>& elseValues,
+                                   std::vector<ValueFlow::Value>& thenValues,
+                                   std::vector<ValueFlow::Value>& elseValues,
                                    bool known = false) const
         {
             const MathLib::bigint path = getPath();
@@ -4443,7 +4551,7 @@ struct ConditionHandler {
     virtual Analyzer::Result forward(Token* start,
                                      const Token* stop,
                                      const Token* exprTok,
-                                     const std::list<ValueFlow::Value>& values,
+                                     const std::vector<ValueFlow::Value>& values,
                                      TokenList& tokenlist,
                                      ErrorLogger& errorLogger,
                                      const Settings& settings,
@@ -4454,7 +4562,7 @@ struct ConditionHandler {
 
     virtual Analyzer::Result forward(Token* top,
                                      const Token* exprTok,
-                                     const std::list<ValueFlow::Value>& values,
+                                     const std::vector<ValueFlow::Value>& values,
                                      TokenList& tokenlist,
                                      ErrorLogger& errorLogger,
                                      const Settings& settings,
@@ -4466,7 +4574,7 @@ struct ConditionHandler {
     virtual void reverse(Token* start,
                          const Token* endToken,
                          const Token* exprTok,
-                         const std::list<ValueFlow::Value>& values,
+                         const std::vector<ValueFlow::Value>& values,
                          TokenList& tokenlist,
                          ErrorLogger& errorLogger,
                          const Settings& settings,
@@ -4476,22 +4584,21 @@ struct ConditionHandler {
     }
 
     void traverseCondition(const SymbolDatabase& symboldatabase,
+                           ErrorLogger& errorLogger,
                            const Settings& settings,
                            const std::set<const Scope*>& skippedFunctions,
-                           const std::function<void(const Condition& cond, Token* tok, const Scope* scope)>& f) const
+                           const std::function<void(const Condition& cond, Token* tok, const Scope* scope, ErrorLogger& scopeLogger)>& f) const
     {
-        for (const Scope *scope : symboldatabase.functionScopes) {
-            if (skippedFunctions.count(scope))
-                continue;
+        forEachFunctionScope(symboldatabase, errorLogger, settings, skippedFunctions, [&](const Scope* scope, ErrorLogger& scopeLogger) {
             for (auto *tok = const_cast<Token *>(scope->bodyStart); tok != scope->bodyEnd; tok = tok->next()) {
-                if (Token::Match(tok, "if|while|for ("))
+                if (Token::Match(tok, MATCH_PATTERN("if|while|for (")))
                     continue;
-                if (Token::Match(tok, ":|;|,"))
+                if (Token::Match(tok, MATCH_PATTERN(":|;|,")))
                     continue;
 
                 const Token* top = tok->astTop();
 
-                if (!Token::Match(top->previous(), "if|while|for (") && !Token::Match(tok->astParent(), "&&|%oror%|?|!"))
+                if (!Token::Match(top->previous(), MATCH_PATTERN("if|while|for (")) && !Token::Match(tok->astParent(), MATCH_PATTERN("&&|%oror%|?|!")))
                     continue;
                 for (const Condition& cond : parse(tok, settings)) {
                     if (!cond.vartok)
@@ -4504,10 +4611,10 @@ struct ConditionHandler {
                         continue;
                     if (!isConstExpression(cond.vartok, settings.library))
                         continue;
-                    f(cond, tok, scope);
+                    f(cond, tok, scope, scopeLogger);
                 }
             }
-        }
+        });
     }
 
     void beforeCondition(TokenList& tokenlist,
@@ -4515,7 +4622,7 @@ struct ConditionHandler {
                          ErrorLogger& errorLogger,
                          const Settings& settings,
                          const std::set<const Scope*>& skippedFunctions) const {
-        traverseCondition(symboldatabase, settings, skippedFunctions, [&](const Condition& cond, Token* tok, const Scope*) {
+        traverseCondition(symboldatabase, errorLogger, settings, skippedFunctions, [&](const Condition& cond, Token* tok, const Scope*, ErrorLogger& scopeLogger) {
             if (cond.vartok->exprId() == 0)
                 return;
 
@@ -4533,7 +4640,7 @@ struct ConditionHandler {
             if (Token::simpleMatch(tok->astParent(), "?") && tok->astParent()->isExpandedMacro()) {
                 if (settings.debugwarnings)
                     bailout(tokenlist,
-                            errorLogger,
+                            scopeLogger,
                             tok,
                             "variable '" + cond.vartok->expressionString() + "', condition is defined in macro");
                 return;
@@ -4543,7 +4650,7 @@ struct ConditionHandler {
             if (Token::simpleMatch(top->previous(), "if (") && top->previous()->isExpandedMacro()) {
                 if (settings.debugwarnings)
                     bailout(tokenlist,
-                            errorLogger,
+                            scopeLogger,
                             tok,
                             "variable '" + cond.vartok->expressionString() + "', condition is defined in macro");
                 return;
@@ -4552,7 +4659,7 @@ struct ConditionHandler {
             if (cond.true_values.empty() && cond.false_values.empty())
                 return;
 
-            std::list<ValueFlow::Value> values = cond.true_values;
+            std::vector<ValueFlow::Value> values = cond.true_values;
             if (cond.true_values != cond.false_values)
                 values.insert(values.end(), cond.false_values.cbegin(), cond.false_values.cend());
 
@@ -4561,11 +4668,11 @@ struct ConditionHandler {
                 if (cond.vartok->valueType() && cond.vartok->valueType()->sign != ValueType::Sign::UNSIGNED)
                     return;
 
-                values.remove_if([](const ValueFlow::Value& v) {
+                values.erase(std::remove_if(values.begin(), values.end(), [](const ValueFlow::Value& v) {
                     if (v.isIntValue())
                         return v.intvalue != 0;
                     return false;
-                });
+                }), values.end());
             }
             if (values.empty())
                 return;
@@ -4580,7 +4687,7 @@ struct ConditionHandler {
                             cond.vartok, top->astOperand2()->astOperand2(), top->link(), settings)) {
                         if (settings.debugwarnings)
                             bailout(tokenlist,
-                                    errorLogger,
+                                    scopeLogger,
                                     tok,
                                     "variable '" + cond.vartok->expressionString() + "' used in loop");
                         return;
@@ -4600,11 +4707,11 @@ struct ConditionHandler {
                     }) && !findEscapeStatement(block->scope(), settings.library)) {
                         // Start at the end of the loop body
                         Token* bodyTok = top->link()->next();
-                        reverse(bodyTok->link(), bodyTok, cond.vartok, values, tokenlist, errorLogger, settings);
+                        reverse(bodyTok->link(), bodyTok, cond.vartok, values, tokenlist, scopeLogger, settings);
                     }
                     if (settings.debugwarnings)
                         bailout(tokenlist,
-                                errorLogger,
+                                scopeLogger,
                                 tok,
                                 "variable '" + cond.vartok->expressionString() + "' used in loop");
                     return;
@@ -4619,7 +4726,7 @@ struct ConditionHandler {
             if (!startTok)
                 startTok = tok->previous();
 
-            reverse(startTok, nullptr, cond.vartok, values, tokenlist, errorLogger, settings);
+            reverse(startTok, nullptr, cond.vartok, values, tokenlist, scopeLogger, settings);
         });
     }
 
@@ -4662,7 +4769,7 @@ struct ConditionHandler {
         });
     }
 
-    static void lowerToInconclusive(std::list<ValueFlow::Value>& values)
+    static void lowerToInconclusive(std::vector<ValueFlow::Value>& values)
     {
         for (ValueFlow::Value& v : values) {
             if (!v.isImpossible())
@@ -4675,12 +4782,12 @@ struct ConditionHandler {
                         ErrorLogger& errorLogger,
                         const Settings& settings,
                         const std::set<const Scope*>& skippedFunctions) const {
-        traverseCondition(symboldatabase, settings, skippedFunctions, [&](const Condition& cond, Token* condTok, const Scope* scope) {
+        traverseCondition(symboldatabase, errorLogger, settings, skippedFunctions, [&](const Condition& cond, Token* condTok, const Scope* scope, ErrorLogger& scopeLogger) {
             const MathLib::bigint path = cond.getPath();
             const bool allowKnown = path == 0;
 
-            std::list<ValueFlow::Value> thenValues;
-            std::list<ValueFlow::Value> elseValues;
+            std::vector<ValueFlow::Value> thenValues;
+            std::vector<ValueFlow::Value> elseValues;
 
             Token* ctx = cond.getContextAndValues(condTok, thenValues, elseValues);
 
@@ -4697,12 +4804,12 @@ struct ConditionHandler {
                     if (astIsLHS(parent) && parent->astParent() && parent->astParent()->str() == parent->str()) {
                         nextExprs.push_back(parent->astParent()->astOperand2());
                     }
-                    std::list<ValueFlow::Value> andValues;
-                    std::list<ValueFlow::Value> orValues;
+                    std::vector<ValueFlow::Value> andValues;
+                    std::vector<ValueFlow::Value> orValues;
                     cond.getContextAndValues(condTok, andValues, orValues, true);
 
                     const std::string& op(parent->str());
-                    std::list<ValueFlow::Value> values;
+                    std::vector<ValueFlow::Value> values;
                     if (op == "&&")
                         values = std::move(andValues);
                     else if (op == "||")
@@ -4714,11 +4821,11 @@ struct ConditionHandler {
                          std::all_of(values.cbegin(), values.cend(), [](const ValueFlow::Value& v) {
                         return v.isIntValue() || v.isFloatValue();
                     })))
-                        values.remove_if([&](const ValueFlow::Value& v) {
+                        values.erase(std::remove_if(values.begin(), values.end(), [&](const ValueFlow::Value& v) {
                             return v.isImpossible();
-                        });
+                        }), values.end());
                     for (Token* start:nextExprs) {
-                        Analyzer::Result r = forward(start, cond.vartok, values, tokenlist, errorLogger, settings);
+                        Analyzer::Result r = forward(start, cond.vartok, values, tokenlist, scopeLogger, settings);
                         if (r.terminate != Analyzer::Terminate::None || r.action.isModified())
                             return;
                     }
@@ -4753,7 +4860,7 @@ struct ConditionHandler {
             Token* top = condTok->astTop();
 
             if (top->previous()->isExpandedMacro()) {
-                for (std::list<ValueFlow::Value>* values : {&thenValues, &elseValues}) {
+                for (std::vector<ValueFlow::Value>* values : {&thenValues, &elseValues}) {
                     for (ValueFlow::Value& v : *values)
                         v.macro = true;
                 }
@@ -4777,8 +4884,8 @@ struct ConditionHandler {
 
             if (Token::simpleMatch(condTop, "?")) {
                 Token* colon = condTop->astOperand2();
-                forward(colon->astOperand1(), cond.vartok, thenValues, tokenlist, errorLogger, settings);
-                forward(colon->astOperand2(), cond.vartok, elseValues, tokenlist, errorLogger, settings);
+                forward(colon->astOperand1(), cond.vartok, thenValues, tokenlist, scopeLogger, settings);
+                forward(colon->astOperand2(), cond.vartok, elseValues, tokenlist, scopeLogger, settings);
                 // TODO: Handle after condition
                 return;
             }
@@ -4836,7 +4943,7 @@ struct ConditionHandler {
                 if (result == 0)
                     return;
                 // Remove condition since for condition is not redundant
-                for (std::list<ValueFlow::Value>* values : {&thenValues, &elseValues}) {
+                for (std::vector<ValueFlow::Value>* values : {&thenValues, &elseValues}) {
                     for (ValueFlow::Value& v : *values) {
                         v.condition = nullptr;
                         v.conditional = true;
@@ -4860,11 +4967,11 @@ struct ConditionHandler {
                 const Token* const startToken = startTokens[i];
                 if (!startToken)
                     continue;
-                std::list<ValueFlow::Value>& values = (i == 0 ? thenValues : elseValues);
+                std::vector<ValueFlow::Value>& values = (i == 0 ? thenValues : elseValues);
                 if (allowKnown)
                     valueFlowSetConditionToKnown(condTok, values, i == 0);
 
-                Analyzer::Result r = forward(startTokens[i], startTokens[i]->link(), cond.vartok, values, tokenlist, errorLogger, settings);
+                Analyzer::Result r = forward(startTokens[i], startTokens[i]->link(), cond.vartok, values, tokenlist, scopeLogger, settings);
                 deadBranch[i] = r.terminate == Analyzer::Terminate::Escape;
                 if (r.action.isModified() && !deadBranch[i])
                     changeBlock = i;
@@ -4876,7 +4983,7 @@ struct ConditionHandler {
             if (changeBlock >= 0 && !Token::simpleMatch(top->previous(), "while (")) {
                 if (settings.debugwarnings)
                     bailout(tokenlist,
-                            errorLogger,
+                            scopeLogger,
                             startTokens[changeBlock]->link(),
                             "valueFlowAfterCondition: " + cond.vartok->expressionString() +
                             " is changed in conditional block");
@@ -4885,7 +4992,7 @@ struct ConditionHandler {
             if (bailBlock >= 0) {
                 if (settings.debugwarnings)
                     bailout(tokenlist,
-                            errorLogger,
+                            scopeLogger,
                             startTokens[bailBlock]->link(),
                             "valueFlowAfterCondition: bailing in conditional block");
                 return;
@@ -4907,7 +5014,7 @@ struct ConditionHandler {
                 // conditional code -> lower them to inconclusive.
                 if (!dead_if && unknownFunction) {
                     if (settings.debugwarnings)
-                        bailout(tokenlist, errorLogger, unknownFunction, "possible noreturn scope");
+                        bailout(tokenlist, scopeLogger, unknownFunction, "possible noreturn scope");
                     lowerToInconclusive(thenValues);
                 }
 
@@ -4918,7 +5025,7 @@ struct ConditionHandler {
                         dead_else = isReturnScope(after, settings.library, &unknownFunction);
                     if (!dead_else && unknownFunction) {
                         if (settings.debugwarnings)
-                            bailout(tokenlist, errorLogger, unknownFunction, "possible noreturn scope");
+                            bailout(tokenlist, scopeLogger, unknownFunction, "possible noreturn scope");
                         lowerToInconclusive(elseValues);
                     }
                 }
@@ -4926,7 +5033,7 @@ struct ConditionHandler {
                 if (dead_if && dead_else)
                     return;
 
-                std::list<ValueFlow::Value> values;
+                std::vector<ValueFlow::Value> values;
                 if (dead_if) {
                     values = std::move(elseValues);
                 } else if (dead_else) {
@@ -4965,7 +5072,7 @@ struct ConditionHandler {
                             possible = op == "&&";
                     }
                     if (possible) {
-                        values.remove_if(std::mem_fn(&ValueFlow::Value::isImpossible));
+                        values.erase(std::remove_if(values.begin(), values.end(), std::mem_fn(&ValueFlow::Value::isImpossible)), values.end());
                         changeKnownToPossible(values);
                     } else if (allowKnown) {
                         valueFlowSetConditionToKnown(condTok, values, true);
@@ -4980,7 +5087,7 @@ struct ConditionHandler {
                 if (isKnown && isBreakOrContinueScope(after)) {
                     const Scope* loopScope = getLoopScope(cond.vartok);
                     if (loopScope) {
-                        Analyzer::Result r = forward(after, loopScope->bodyEnd, cond.vartok, values, tokenlist, errorLogger, settings);
+                        Analyzer::Result r = forward(after, loopScope->bodyEnd, cond.vartok, values, tokenlist, scopeLogger, settings);
                         if (r.terminate != Analyzer::Terminate::None)
                             return;
                         if (r.action.isModified())
@@ -4988,14 +5095,14 @@ struct ConditionHandler {
                         auto* start = const_cast<Token*>(loopScope->bodyEnd);
                         if (Token::simpleMatch(start, "} while (")) {
                             start = start->tokAt(2);
-                            forward(start, start->link(), cond.vartok, values, tokenlist, errorLogger, settings);
+                            forward(start, start->link(), cond.vartok, values, tokenlist, scopeLogger, settings);
                             start = start->link();
                         }
-                        values.remove_if(std::mem_fn(&ValueFlow::Value::isImpossible));
+                        values.erase(std::remove_if(values.begin(), values.end(), std::mem_fn(&ValueFlow::Value::isImpossible)), values.end());
                         changeKnownToPossible(values);
                     }
                 }
-                forward(after, ValueFlow::getEndOfExprScope(cond.vartok, scope), cond.vartok, values, tokenlist, errorLogger, settings);
+                forward(after, ValueFlow::getEndOfExprScope(cond.vartok, scope), cond.vartok, values, tokenlist, scopeLogger, settings);
             }
         });
     }
@@ -5433,18 +5540,18 @@ static void valueFlowForLoop(const TokenList &tokenlist, const SymbolDatabase& s
             const bool executeBody = !knownInitValue || initValue <= lastValue;
             const Token* vartok = Token::findmatch(tok, "%varid%", bodyStart, varid);
             if (executeBody && vartok) {
-                std::list<ValueFlow::Value> initValues;
+                std::vector<ValueFlow::Value> initValues;
                 initValues.emplace_back(initValue, ValueFlow::Value::Bound::Lower);
                 initValues.push_back(ValueFlow::asImpossible(initValues.back()));
                 Analyzer::Result result = valueFlowForward(bodyStart, bodyStart->link(), vartok, std::move(initValues), tokenlist, errorLogger, settings);
 
                 if (!result.action.isModified()) {
-                    std::list<ValueFlow::Value> lastValues;
+                    std::vector<ValueFlow::Value> lastValues;
                     lastValues.emplace_back(lastValue, ValueFlow::Value::Bound::Upper);
                     lastValues.back().conditional = true;
                     lastValues.push_back(ValueFlow::asImpossible(lastValues.back()));
                     if (stepValue != 1)
-                        lastValues.pop_front();
+                        lastValues.erase(lastValues.begin());
                     valueFlowForward(bodyStart, bodyStart->link(), vartok, std::move(lastValues), tokenlist, errorLogger, settings);
                 }
             }
@@ -5495,7 +5602,7 @@ static void valueFlowForLoop(const TokenList &tokenlist, const SymbolDatabase& s
 }
 
 template<class Key, class F>
-static bool productParams(const Settings& settings, const std::unordered_map<Key, std::list<ValueFlow::Value>>& vars, F f)
+static bool productParams(const Settings& settings, const std::unordered_map<Key, std::vector<ValueFlow::Value>>& vars, F f)
 {
     using Args = std::vector<std::unordered_map<Key, ValueFlow::Value>>;
     Args args(1);
@@ -5558,7 +5665,7 @@ static void valueFlowInjectParameter(const TokenList& tokenlist,
                                      ErrorLogger& errorLogger,
                                      const Settings& settings,
                                      const Scope* functionScope,
-                                     const std::unordered_map<const Variable*, std::list<ValueFlow::Value>>& vars)
+                                     const std::unordered_map<const Variable*, std::vector<ValueFlow::Value>>& vars)
 {
     const bool r = productParams(settings, vars, [&](const std::unordered_map<const Variable*, ValueFlow::Value>& arg) {
         auto a = makeMultiValueFlowAnalyzer(arg, settings);
@@ -5583,7 +5690,7 @@ static void valueFlowInjectParameter(const TokenList& tokenlist,
                                      const Settings& settings,
                                      const Variable* arg,
                                      const Scope* functionScope,
-                                     std::list<ValueFlow::Value> argvalues)
+                                     std::vector<ValueFlow::Value> argvalues)
 {
     // Is argument passed by value or const reference, and is it a known non-class type?
     if (arg->isReference() && !arg->isConst() && !arg->isClass())
@@ -5631,7 +5738,7 @@ static void valueFlowSwitchVariable(const TokenList& tokenlist,
                 continue;
             }
             if (Token::Match(tok, "case %num% :")) {
-                std::list<ValueFlow::Value> values;
+                std::vector<ValueFlow::Value> values;
                 values.emplace_back(MathLib::toBigNumber(tok->tokAt(1)));
                 values.back().condition = tok;
                 values.back().errorPath.emplace_back(tok,
@@ -5678,9 +5785,9 @@ static void valueFlowSwitchVariable(const TokenList& tokenlist,
     }
 }
 
-static std::list<ValueFlow::Value> getFunctionArgumentValues(const Token* argtok)
+static std::vector<ValueFlow::Value> getFunctionArgumentValues(const Token* argtok)
 {
-    std::list<ValueFlow::Value> argvalues(argtok->values());
+    std::vector<ValueFlow::Value> argvalues(argtok->values());
     removeImpossible(argvalues);
     if (argvalues.empty() && Token::Match(argtok, "%comp%|%oror%|&&|!")) {
         argvalues.emplace_back(0);
@@ -5691,7 +5798,7 @@ static std::list<ValueFlow::Value> getFunctionArgumentValues(const Token* argtok
 
 static void valueFlowLibraryFunction(Token* tok, const std::string& returnValue, const Settings& settings)
 {
-    std::unordered_map<nonneg int, std::list<ValueFlow::Value>> argValues;
+    std::unordered_map<nonneg int, std::vector<ValueFlow::Value>> argValues;
     int argn = 1;
     for (const Token* argtok : getArguments(tok->previous())) {
         argValues[argn] = getFunctionArgumentValues(argtok);
@@ -5749,7 +5856,7 @@ static void valueFlowSubFunction(const TokenList& tokenlist,
                 continue;
 
             id++;
-            std::unordered_map<const Variable*, std::list<ValueFlow::Value>> argvars;
+            std::unordered_map<const Variable*, std::vector<ValueFlow::Value>> argvars;
             // TODO: Rewrite this. It does not work well to inject 1 argument at a time.
             const std::vector<const Token*>& callArguments = getArguments(tok);
             for (int argnr = 0U; argnr < callArguments.size(); ++argnr) {
@@ -5760,14 +5867,14 @@ static void valueFlowSubFunction(const TokenList& tokenlist,
                     break;
 
                 // passing value(s) to function
-                std::list<ValueFlow::Value> argvalues(getFunctionArgumentValues(argtok));
+                std::vector<ValueFlow::Value> argvalues(getFunctionArgumentValues(argtok));
 
                 // Remove non-local lifetimes
-                argvalues.remove_if([](const ValueFlow::Value& v) {
+                argvalues.erase(std::remove_if(argvalues.begin(), argvalues.end(), [](const ValueFlow::Value& v) {
                     if (v.isLifetimeValue())
                         return !v.isLocalLifetimeValue() && !v.isSubFunctionLifetimeValue();
                     return false;
-                });
+                }), argvalues.end());
                 // Remove uninit values if argument is passed by value
                 if (argtok->variable() && !argtok->variable()->isPointer() && argvalues.size() == 1 &&
                     argvalues.front().isUninitValue()) {
@@ -5813,8 +5920,8 @@ static void valueFlowFunctionDefaultParameter(const TokenList& tokenlist, const
         for (size_t arg = function->minArgCount(); arg < function->argCount(); arg++) {
             const Variable* var = function->getArgumentVar(arg);
             if (var && var->hasDefault() && Token::Match(var->nameToken(), "%var% = %num%|%str%|%char%|%name% [,)]")) {
-                const std::list<ValueFlow::Value> &values = var->nameToken()->tokAt(2)->values();
-                std::list<ValueFlow::Value> argvalues;
+                const std::vector<ValueFlow::Value> &values = var->nameToken()->tokAt(2)->values();
+                std::vector<ValueFlow::Value> argvalues;
                 for (const ValueFlow::Value &value : values) {
                     if (!value.isKnown())
                         continue;
@@ -5983,19 +6090,14 @@ static bool needsInitialization(const Variable* var)
 static void addToErrorPath(ValueFlow::Value& value, const ValueFlow::Value& from)
 {
     std::unordered_set<const Token*> locations;
-    std::transform(value.errorPath.cbegin(),
-                   value.errorPath.cend(),
-                   std::inserter(locations, locations.begin()),
-                   [](const ErrorPathItem& e) {
-        return e.first;
+    value.errorPath.forEach([&](const Token* tok, const std::string& /*info*/) {
+        locations.insert(tok);
     });
     if (from.condition && !value.condition)
         value.condition = from.condition;
-    std::copy_if(from.errorPath.cbegin(),
-                 from.errorPath.cend(),
-                 std::back_inserter(value.errorPath),
-                 [&](const ErrorPathItem& e) {
-        return locations.insert(e.first).second;
+    from.errorPath.forEach([&](const Token* tok, const std::string& info) {
+        if (locations.insert(tok).second)
+            value.errorPath.emplace_back(tok, info);
     });
 }
 
@@ -6129,7 +6231,7 @@ static void valueFlowUninit(TokenList& tokenlist, ErrorLogger& errorLogger, cons
                             continue;
                         addToErrorPath(v2, v);
                     }
-                    v2.subexpressions.push_back(memVar.nameToken()->str());
+                    v2.addSubexpression(memVar.nameToken()->str());
                 }
             }
         }
@@ -6357,7 +6459,7 @@ static void valueFlowSmartPointer(TokenList &tokenlist, ErrorLogger & errorLogge
                 if (Token::Match(tok, "%var% (|{") && tok->next()->astOperand2() &&
                     tok->next()->astOperand2()->str() != ",") {
                     Token* inTok = tok->next()->astOperand2();
-                    const std::list<ValueFlow::Value>& values = inTok->values();
+                    const std::vector<ValueFlow::Value>& values = inTok->values();
                     const bool constValue = inTok->isNumber();
                     valueFlowForwardAssign(inTok, var, values, constValue, true, tokenlist, errorLogger, settings);
 
@@ -6381,7 +6483,7 @@ static void valueFlowSmartPointer(TokenList &tokenlist, ErrorLogger & errorLogge
                     Token* inTok = ftok->astOperand2();
                     if (!inTok)
                         continue;
-                    const std::list<ValueFlow::Value>& values = inTok->values();
+                    const std::vector<ValueFlow::Value>& values = inTok->values();
                     valueFlowForwardAssign(inTok, tok, std::move(vars), values, false, tokenlist, errorLogger, settings);
                 }
             } else if (Token::simpleMatch(tok->astParent(), ". release ( )")) {
@@ -6455,14 +6557,14 @@ static void valueFlowIterators(TokenList& tokenlist, const Settings& settings)
     }
 }
 
-static std::list<ValueFlow::Value> getIteratorValues(std::list<ValueFlow::Value> values,
+static std::vector<ValueFlow::Value> getIteratorValues(std::vector<ValueFlow::Value> values,
                                                      const ValueFlow::Value::ValueKind* kind = nullptr)
 {
-    values.remove_if([&](const ValueFlow::Value& v) {
+    values.erase(std::remove_if(values.begin(), values.end(), [&](const ValueFlow::Value& v) {
         if (kind && v.valueKind != *kind)
             return true;
         return !v.isIteratorValue();
-    });
+    }), values.end());
     return values;
 }
 
@@ -6475,7 +6577,7 @@ struct IteratorConditionHandler : SimpleConditionHandler {
                 return {};
 
             constexpr ValueFlow::Value::ValueKind kind = ValueFlow::Value::ValueKind::Known;
-            std::list<ValueFlow::Value> values = getIteratorValues(tok->astOperand1()->values(), &kind);
+            std::vector<ValueFlow::Value> values = getIteratorValues(tok->astOperand1()->values(), &kind);
             if (!values.empty()) {
                 cond.vartok = tok->astOperand2();
             } else {
@@ -6502,8 +6604,8 @@ static void valueFlowIteratorInfer(TokenList& tokenlist, const Settings& setting
             continue;
         if (!tok->scope()->isExecutable())
             continue;
-        std::list<ValueFlow::Value> values = getIteratorValues(tok->values());
-        values.remove_if([&](const ValueFlow::Value& v) {
+        std::vector<ValueFlow::Value> values = getIteratorValues(tok->values());
+        values.erase(std::remove_if(values.begin(), values.end(), [&](const ValueFlow::Value& v) {
             if (!v.isImpossible())
                 return true;
             if (!v.condition)
@@ -6515,7 +6617,7 @@ static void valueFlowIteratorInfer(TokenList& tokenlist, const Settings& setting
             if (v.isIteratorStartValue() && v.intvalue >= 0)
                 return true;
             return false;
-        });
+        }), values.end());
         for (ValueFlow::Value& v : values) {
             v.setPossible();
             if (v.isIteratorStartValue())
@@ -7101,7 +7203,7 @@ static void valueFlowSafeFunctions(const TokenList& tokenlist, const SymbolDatab
             if (arg.valueType()->type == ValueType::Type::CONTAINER) {
                 if (!safe)
                     continue;
-                std::list<ValueFlow::Value> argValues;
+                std::vector<ValueFlow::Value> argValues;
                 argValues.emplace_back(0);
                 argValues.back().valueType = ValueFlow::Value::ValueType::CONTAINER_SIZE;
                 argValues.back().errorPath.emplace_back(arg.nameToken(), "Assuming " + arg.name() + " is empty");
@@ -7134,7 +7236,7 @@ static void valueFlowSafeFunctions(const TokenList& tokenlist, const SymbolDatab
                         high = maxValue;
                     isLow = isHigh = true;
                 } else if (arg.valueType()->type == ValueType::Type::FLOAT || arg.valueType()->type == ValueType::Type::DOUBLE || arg.valueType()->type == ValueType::Type::LONGDOUBLE) {
-                    std::list<ValueFlow::Value> argValues;
+                    std::vector<ValueFlow::Value> argValues;
                     argValues.emplace_back(0);
                     argValues.back().valueType = ValueFlow::Value::ValueType::FLOAT;
                     argValues.back().floatValue = isLow ? static_cast<double>(low) : -1E25;
@@ -7156,7 +7258,7 @@ static void valueFlowSafeFunctions(const TokenList& tokenlist, const SymbolDatab
                 }
             }
 
-            std::list<ValueFlow::Value> argValues;
+            std::vector<ValueFlow::Value> argValues;
             if (isLow) {
                 argValues.emplace_back(low);
                 argValues.back().errorPath.emplace_back(arg.nameToken(), std::string(safeLow ? "Safe checks: " : "") + "Assuming argument has value " + MathLib::toString(low));
@@ -7238,8 +7340,8 @@ static void valueFlowDebug(TokenList& tokenlist, ErrorLogger& errorLogger, const
             continue;
         for (const ValueFlow::Value& v : tok->values()) {
             std::string msg = "The value is " + debugString(v);
-            ErrorPath errorPath = v.errorPath;
-            errorPath.insert(errorPath.end(), v.debugPath.cbegin(), v.debugPath.cend());
+            ErrorPath errorPath = v.errorPath.toList();
+            errorPath.insert(errorPath.end(), v.debugPath().cbegin(), v.debugPath().cend());
             errorPath.emplace_back(tok, "");
             errorLogger.reportErr({std::move(errorPath), &tokenlist, Severity::debug, "valueFlow", msg, CWE{0}, Certainty::normal});
         }
@@ -7280,14 +7382,16 @@ struct ValueFlowPass {
     virtual void run(const ValueFlowState& state) const = 0;
     // Returns true if pass needs C++
     virtual bool cpp() const = 0;
+    // What the pass produces
+    virtual ValueFlow::Product product() const = 0;
     virtual ~ValueFlowPass() noexcept = default;
 };
 
 struct ValueFlowPassRunner {
     using Clock = std::chrono::steady_clock;
     using TimePoint = std::chrono::time_point<Clock>;
-    explicit ValueFlowPassRunner(ValueFlowState state, TimerResultsIntf* timerResults = nullptr)
-        : state(std::move(state)), stop(TimePoint::max()), timerResults(timerResults)
+    explicit ValueFlowPassRunner(ValueFlowState state, TimerResultsIntf* timerResults = nullptr, std::set<ValueFlow::Product> products = ValueFlow::getAllProducts())
+        : state(std::move(state)), stop(TimePoint::max()), timerResults(timerResults), products(std::move(products))
     {
         setSkippedFunctions();
         setStopTime();
@@ -7305,17 +7409,48 @@ struct ValueFlowPassRunner {
         std::size_t values = 0;
         std::size_t n = state.settings.vfOptions.maxIterations;
         const bool doProgress = state.settings.reportProgress >= 0;
+        // The values are the only input a pass gets from the other passes. Remember the value changes
+        // at which each pass had nothing more to add. Such a pass will not find anything new until
+        // another pass changes the values again. The same is tracked for each function scope so the
+        // passes can skip the functions where nothing changed.
+        std::vector<std::size_t> settled(passes.size(), std::numeric_limits<std::size_t>::max());
+        std::vector<std::unordered_map<const Scope*, std::size_t>> settledScopes(passes.size());
         while (n > 0 && values != getTotalValues()) {
             values = getTotalValues();
             const std::size_t passnum = state.settings.vfOptions.maxIterations - n + 1;
             const std::string passnum_s = std::to_string(passnum);
-            if (std::any_of(passes.begin(), passes.end(), [&](const ValuePtr<ValueFlowPass>& pass) {
+            std::size_t index = 0;
+            for (const ValuePtr<ValueFlowPass>& pass : passes) {
+                std::size_t& passSettled = settled[index];
+                std::unordered_map<const Scope*, std::size_t>& passSettledScopes = settledScopes[index];
+                ++index;
+                const std::size_t changes = state.tokenlist.getValueChanges();
+                if (passSettled == changes)
+                    continue;
+                ValueFlowState passState = state;
+                std::unordered_map<const Scope*, std::size_t> scopeChanges = getFunctionValueChanges();
+                for (const auto& settledScope : passSettledScopes) {
+                    if (scopeChanges[settledScope.first] == settledScope.second)
+                        passState.skippedFunctions.insert(settledScope.first);
+                }
                 // the string concatination is a hot spot in TestIO::testScanfArgument and TestIO::testPrintfArgumentVariables
                 std::string stage = doProgress ? std::string("ValueFlow::") + pass->name() + (' ' + passnum_s) : "";
                 ProgressReporter progressReporter(state.errorLogger, state.settings.reportProgress, state.tokenlist.getSourceFilePath(), std::move(stage));
-                return run(pass, passnum);
-            }))
-                return true;
+                if (run(pass, passnum, passState))
+                    return true;
+                // the pass might depend on its own results so it is only settled if it did not change anything
+                if (state.tokenlist.getValueChanges() == changes)
+                    passSettled = changes;
+                const std::unordered_map<const Scope*, std::size_t> newScopeChanges = getFunctionValueChanges();
+                for (const Scope* functionScope : state.symboldatabase.functionScopes) {
+                    const auto it = newScopeChanges.find(functionScope);
+                    const std::size_t newChanges = it == newScopeChanges.end() ? 0 : it->second;
+                    if (scopeChanges[functionScope] == newChanges)
+                        passSettledScopes[functionScope] = newChanges;
+                    else
+                        passSettledScopes.erase(functionScope);
+                }
+            }
             --n;
         }
         if (state.settings.debugwarnings) {
@@ -7334,6 +7469,11 @@ struct ValueFlowPassRunner {
     }
 
     bool run(const ValuePtr<ValueFlowPass>& pass, std::size_t it) const
+    {
+        return run(pass, it, state);
+    }
+
+    bool run(const ValuePtr<ValueFlowPass>& pass, std::size_t it, const ValueFlowState& passState) const
     {
         auto start = Clock::now();
         if (start > stop) {
@@ -7342,6 +7482,8 @@ struct ValueFlowPassRunner {
         }
         if (!state.tokenlist.isCPP() && pass->cpp())
             return false;
+        if (products.count(pass->product()) == 0)
+            return false;
         if (timerResults) {
             std::string name = pass->name();
             if (it > 0) {
@@ -7349,13 +7491,36 @@ struct ValueFlowPassRunner {
                 name += std::to_string(it);
             }
             Timer t(name, timerResults);
-            pass->run(state);
+            pass->run(passState);
         } else {
-            pass->run(state);
+            pass->run(passState);
         }
         return false;
     }
 
+    // The value changes in each function scope. Changes outside of the functions are added to all functions.
+    std::unordered_map<const Scope*, std::size_t> getFunctionValueChanges() const
+    {
+        std::unordered_map<const Scope*, std::size_t> result;
+        std::size_t globalChanges = 0;
+        for (const auto& scopeChanges : state.tokenlist.getScopeValueChanges()) {
+            bool inFunction = false;
+            for (const Scope* scope = scopeChanges.first; scope; scope = scope->nestedIn) {
+                if (scope->type != ScopeType::eFunction)
+                    continue;
+                result[scope] += scopeChanges.second;
+                inFunction = true;
+            }
+            if (!inFunction)
+                globalChanges += scopeChanges.second;
+        }
+        if (globalChanges > 0) {
+            for (const Scope* functionScope : state.symboldatabase.functionScopes)
+                result[functionScope] += globalChanges;
+        }
+        return result;
+    }
+
     std::size_t getTotalValues() const
     {
         std::size_t n = 1;
@@ -7410,14 +7575,17 @@ struct ValueFlowPassRunner {
     ValueFlowState state;
     TimePoint stop;
     TimerResultsIntf* timerResults;
+    std::set<ValueFlow::Product> products;
 };
 
 template<class F>
 struct ValueFlowPassAdaptor : ValueFlowPass {
     const char* mName = nullptr;
     bool mCPP = false;
+    ValueFlow::Product mProduct;
     F mRun;
-    ValueFlowPassAdaptor(const char* pname, bool pcpp, F prun) : ValueFlowPass(), mName(pname), mCPP(pcpp), mRun(prun) {}
+    ValueFlowPassAdaptor(const char* pname, bool pcpp, ValueFlow::Product pproduct, F prun)
+        : ValueFlowPass(), mName(pname), mCPP(pcpp), mProduct(pproduct), mRun(prun) {}
     const char* name() const override {
         return mName;
     }
@@ -7428,17 +7596,21 @@ struct ValueFlowPassAdaptor : ValueFlowPass {
     bool cpp() const override {
         return mCPP;
     }
+    ValueFlow::Product product() const override {
+        return mProduct;
+    }
 };
 
 template<class F>
-static ValueFlowPassAdaptor<F> makeValueFlowPassAdaptor(const char* name, bool cpp, F run)
+static ValueFlowPassAdaptor<F> makeValueFlowPassAdaptor(const char* name, bool cpp, ValueFlow::Product product, F run)
 {
-    return {name, cpp, run};
+    return {name, cpp, product, run};
 }
 
-#define VALUEFLOW_ADAPTOR(cpp, ...)                                                                                    \
+#define VALUEFLOW_ADAPTOR(cpp, product, ...)                                                                           \
     makeValueFlowPassAdaptor(#__VA_ARGS__,                                                                             \
                              (cpp),                                                                                      \
+                             (product),                                                                                  \
                              [](TokenList& tokenlist,                                                                  \
                                 SymbolDatabase& symboldatabase,                                                        \
                                 ErrorLogger& errorLogger,                                                              \
@@ -7452,14 +7624,20 @@ static ValueFlowPassAdaptor<F> makeValueFlowPassAdaptor(const char* name, bool c
         __VA_ARGS__;                                                                          \
     })
 
-#define VFA(...) VALUEFLOW_ADAPTOR(false, __VA_ARGS__)
-#define VFA_CPP(...) VALUEFLOW_ADAPTOR(true, __VA_ARGS__)
+#define VFA(...) VALUEFLOW_ADAPTOR(false, ValueFlow::Product::values, __VA_ARGS__)
+#define VFA_CPP(...) VALUEFLOW_ADAPTOR(true, ValueFlow::Product::values, __VA_ARGS__)
+
+std::set<ValueFlow::Product> ValueFlow::getAllProducts()
+{
+    return {Product::values, Product::movedValues};
+}
 
 void ValueFlow::setValues(TokenList& tokenlist,
                           SymbolDatabase& symboldatabase,
                           ErrorLogger& errorLogger,
                           const Settings& settings,
-                          TimerResultsIntf* timerResults)
+                          TimerResultsIntf* timerResults,
+                          const std::set<Product>& products)
 {
     ProgressReporter progressReporter(errorLogger, settings.reportProgress, tokenlist.getSourceFilePath(), "ValueFlow");
 
@@ -7478,7 +7656,7 @@ void ValueFlow::setValues(TokenList& tokenlist,
         }
     }
 
-    ValueFlowPassRunner runner{ValueFlowState{tokenlist, symboldatabase, errorLogger, settings}, timerResults};
+    ValueFlowPassRunner runner{ValueFlowState{tokenlist, symboldatabase, errorLogger, settings}, timerResults, products};
     runner.run_once({
         VFA(valueFlowEnumValueEarly(symboldatabase, settings)),
         VFA(valueFlowNumber(tokenlist, settings)),
@@ -7518,7 +7696,7 @@ void ValueFlow::setValues(TokenList& tokenlist,
         VFA(valueFlowLifetime(tokenlist, errorLogger, settings)),
         VFA(valueFlowFunctionDefaultParameter(tokenlist, symboldatabase, errorLogger, settings)),
         VFA(valueFlowUninit(tokenlist, errorLogger, settings)),
-        VFA_CPP(valueFlowAfterMove(tokenlist, symboldatabase, errorLogger, settings)),
+        VALUEFLOW_ADAPTOR(true, ValueFlow::Product::movedValues, valueFlowAfterMove(tokenlist, symboldatabase, errorLogger, settings)),
         VFA_CPP(valueFlowSmartPointer(tokenlist, errorLogger, settings)),
         VFA_CPP(valueFlowIterators(tokenlist, settings)),
         VFA_CPP(
@@ -7550,7 +7728,7 @@ std::string ValueFlow::eitherTheConditionIsRedundant(const Token *condition)
     return "Either the condition '" + condition->expressionString() + "' is redundant";
 }
 
-const ValueFlow::Value* ValueFlow::findValue(const std::list<ValueFlow::Value>& values,
+const ValueFlow::Value* ValueFlow::findValue(const std::vector<ValueFlow::Value>& values,
                                              const Settings& settings,
                                              const std::function<bool(const ValueFlow::Value&)> &pred)
 {
@@ -25,8 +25,9 @@
 #include "errortypes.h"
 #include "mathlib.h"
 
+#include <cstdint>
 #include <functional>
-#include <list>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -46,6 +47,17 @@ namespace ValueFlow
 }
 
 namespace ValueFlow {
+    /// What the analysis produces. A pass is skipped when none of the consumers needs what it produces.
+    enum class Product : std::uint8_t {
+        /// The values in general
+        values,
+        /// The values of moved and forwarded variables
+        movedValues
+    };
+
+    /// All the products of the analysis
+    std::set<Product> getAllProducts();
+
     /// Constant folding of expression. This can be used before the full ValueFlow has been executed (ValueFlow::setValues).
     const Value * valueFlowConstantFoldAST(Token *expr, const Settings &settings);
 
@@ -54,11 +66,12 @@ namespace ValueFlow {
                    SymbolDatabase& symboldatabase,
                    ErrorLogger& errorLogger,
                    const Settings& settings,
-                   TimerResultsIntf* timerResults);
+                   TimerResultsIntf* timerResults,
+                   const std::set<Product>& products = getAllProducts());
 
     std::string eitherTheConditionIsRedundant(const Token *condition);
 
-    const Value* findValue(const std::list<Value>& values,
+    const Value* findValue(const std::vector<Value>& values,
                            const Settings& settings,
                            const std::function<bool(const Value&)> &pred);
 
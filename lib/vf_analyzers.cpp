@@ -520,7 +520,7 @@ private:
     {
         if (!useSymbolicValues())
             return false;
-        if (Token::Match(tok, "%assign%"))
+        if (Token::Match(tok, MATCH_PATTERN("%assign%")))
             return false;
         const ValueFlow::Value* currValue = getValue(tok);
         if (!currValue)
@@ -556,7 +556,7 @@ private:
             }
             if (!r.empty()) {
                 if (value) {
-                    value->errorPath.insert(value->errorPath.end(), v.errorPath.cbegin(), v.errorPath.cend());
+                    value->errorPath.append(v.errorPath);
                     value->intvalue = r.front() + v.intvalue;
                     if (toImpossible)
                         value->setImpossible();
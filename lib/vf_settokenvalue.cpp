@@ -38,7 +38,6 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
-#include <list>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -346,9 +345,9 @@ namespace ValueFlow
                 setTokenValue(parent, std::move(value), settings);
                 return;
             }
-            if (!value.subexpressions.empty() && Token::Match(parent, ". %var%")) {
-                if (contains(value.subexpressions, parent->strAt(1)))
-                    value.subexpressions.clear();
+            if (!value.subexpressions().empty() && Token::Match(parent, ". %var%")) {
+                if (contains(value.subexpressions(), parent->strAt(1)))
+                    value.clearSubexpressions();
                 else
                     return;
             }
@@ -399,7 +398,7 @@ namespace ValueFlow
                     const Token *op = cond ? tok->astOperand1() : tok->astOperand2();
                     if (!op) // #7769 segmentation fault at setTokenValue()
                         return;
-                    const std::list<Value> &values = op->values();
+                    const std::vector<Value> &values = op->values();
                     if (std::find(values.cbegin(), values.cend(), value) != values.cend())
                         setTokenValue(parent, std::move(value), settings);
                 }
@@ -429,7 +428,7 @@ namespace ValueFlow
 
         else if (parent->str() == "?" && value.isIntValue() && tok == parent->astOperand1() && value.isKnown() &&
                  parent->astOperand2() && parent->astOperand2()->astOperand1() && parent->astOperand2()->astOperand2()) {
-            const std::list<Value> &values = (value.intvalue == 0
+            const std::vector<Value> &values = (value.intvalue == 0
                 ? parent->astOperand2()->astOperand2()->values()
                 : parent->astOperand2()->astOperand1()->values());
 
@@ -22,10 +22,158 @@
 #include "token.h"
 #include "utils.h"
 
+#include <algorithm>
+#include <functional>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
+
+namespace {
+    /**
+     * The texts of the error path items. A text is shared by the items with
+     * the same text and released when the last of them is destroyed.
+     */
+    class ErrorPathStrings {
+    public:
+        std::shared_ptr<const std::string> intern(std::string str) {
+            const std::size_t hash = std::hash<std::string>{}(str);
+            std::lock_guard<std::mutex> lg(mMutex);
+            const auto range = mStrings.equal_range(hash);
+            for (auto it = range.first; it != range.second; ++it) {
+                std::shared_ptr<const std::string> s = it->second.lock();
+                if (s && *s == str)
+                    return s;
+            }
+            auto s = std::make_shared<const std::string>(std::move(str));
+            mStrings.emplace(hash, s);
+            if (mStrings.size() >= mPurgeSize) {
+                for (auto it = mStrings.begin(); it != mStrings.end();) {
+                    if (it->second.expired())
+                        it = mStrings.erase(it);
+                    else
+                        ++it;
+                }
+                mPurgeSize = std::max<std::size_t>(1024, 2 * mStrings.size());
+            }
+            return s;
+        }
+
+    private:
+        std::mutex mMutex;
+        std::unordered_multimap<std::size_t, std::weak_ptr<const std::string>> mStrings;
+        std::size_t mPurgeSize = 1024;
+    };
+
+    ErrorPathStrings& errorPathStrings()
+    {
+        static ErrorPathStrings strings;
+        return strings;
+    }
+}
 
 namespace ValueFlow {
+    SharedErrorPath::SharedErrorPath(const ErrorPath& errorPath) {
+        append(errorPath);
+    }
+
+    SharedErrorPath::~SharedErrorPath() {
+        // release the items which are not shared iteratively so long paths don't overflow the stack
+        while (mLast && mLast.use_count() == 1) {
+            std::shared_ptr<Node> previous = std::move(mLast->previous);
+            mLast = std::move(previous);
+        }
+    }
+
+    SharedErrorPath& SharedErrorPath::operator=(const SharedErrorPath& other) {
+        if (this != &other) {
+            const SharedErrorPath old(std::move(*this));
+            mLast = other.mLast;
+        }
+        return *this;
+    }
+
+    SharedErrorPath& SharedErrorPath::operator=(SharedErrorPath&& other) noexcept {
+        if (this != &other) {
+            const SharedErrorPath old(std::move(*this));
+            mLast = std::move(other.mLast);
+        }
+        return *this;
+    }
+
+    SharedErrorPath& SharedErrorPath::operator=(const ErrorPath& errorPath) {
+        SharedErrorPath p(errorPath);
+        *this = std::move(p);
+        return *this;
+    }
+
+    const Token* SharedErrorPath::backToken() const {
+        assert(mLast);
+        return mLast->token;
+    }
+
+    const std::string& SharedErrorPath::backInfo() const {
+        assert(mLast);
+        return *mLast->info;
+    }
+
+    std::vector<const SharedErrorPath::Node*> SharedErrorPath::nodes() const {
+        std::vector<const Node*> result(size());
+        auto it = result.rbegin();
+        for (const Node* node = mLast.get(); node; node = node->previous.get())
+            *it++ = node;
+        return result;
+    }
+
+    void SharedErrorPath::push(const Token* tok, std::shared_ptr<const std::string> info) {
+        auto node = std::make_shared<Node>();
+        node->size = size() + 1;
+        node->previous = std::move(mLast);
+        node->token = tok;
+        node->info = std::move(info);
+        mLast = std::move(node);
+    }
+
+    void SharedErrorPath::emplace_back(const Token* tok, std::string info) {
+        push(tok, errorPathStrings().intern(std::move(info)));
+    }
+
+    void SharedErrorPath::emplace_front(const Token* tok, std::string info) {
+        ErrorPath errorPath;
+        errorPath.emplace_back(tok, std::move(info));
+        prepend(errorPath);
+    }
+
+    void SharedErrorPath::append(const SharedErrorPath& errorPath) {
+        if (empty()) {
+            mLast = errorPath.mLast;
+            return;
+        }
+        for (const Node* node : errorPath.nodes())
+            push(node->token, node->info);
+    }
+
+    void SharedErrorPath::append(const ErrorPath& errorPath) {
+        for (const ErrorPathItem& e : errorPath)
+            emplace_back(e.first, e.second);
+    }
+
+    void SharedErrorPath::prepend(const ErrorPath& errorPath) {
+        if (errorPath.empty())
+            return;
+        SharedErrorPath p(errorPath);
+        p.append(*this);
+        *this = std::move(p);
+    }
+
+    ErrorPath SharedErrorPath::toList() const {
+        ErrorPath errorPath;
+        forEach([&](const Token* tok, const std::string& info) {
+            errorPath.emplace_back(tok, info);
+        });
+        return errorPath;
+    }
+
     Value::Value(const Token *c, MathLib::bigint val, Bound b)
         : bound(b),
         safe(false),
@@ -43,6 +191,37 @@ namespace ValueFlow {
         errorPath.emplace_back(tok, "Assuming that condition '" + tok->expressionString() + "' is not redundant");
     }
 
+    Value::Extra& Value::extra() {
+        if (!mExtra)
+            mExtra = std::make_shared<Extra>();
+        else if (mExtra.use_count() > 1)
+            mExtra = std::make_shared<Extra>(*mExtra);
+        return *mExtra;
+    }
+
+    const ErrorPath& Value::debugPath() const {
+        static const ErrorPath emptyPath;
+        return mExtra ? mExtra->debugPath : emptyPath;
+    }
+
+    void Value::addDebugPath(ErrorPathItem item) {
+        extra().debugPath.push_back(std::move(item));
+    }
+
+    const std::vector<std::string>& Value::subexpressions() const {
+        static const std::vector<std::string> emptySubexpressions;
+        return mExtra ? mExtra->subexpressions : emptySubexpressions;
+    }
+
+    void Value::addSubexpression(std::string subexpression) {
+        extra().subexpressions.push_back(std::move(subexpression));
+    }
+
+    void Value::clearSubexpressions() {
+        if (mExtra && !mExtra->subexpressions.empty())
+            extra().subexpressions.clear();
+    }
+
     std::string Value::toString() const {
         std::stringstream ss;
         if (this->isImpossible())
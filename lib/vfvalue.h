@@ -27,8 +27,10 @@
 
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -40,6 +42,73 @@ class Token;
 
 namespace ValueFlow
 {
+    /**
+     * Error path of a value. The items are stored in an immutable chain in
+     * which every item points to the one before it, so copies of a path share
+     * their items and adding an item at the end does not copy the path. The
+     * texts of the items are interned.
+     */
+    class CPPCHECKLIB SharedErrorPath {
+    public:
+        SharedErrorPath() = default;
+        explicit SharedErrorPath(const ErrorPath& errorPath);
+        SharedErrorPath(const SharedErrorPath&) = default;
+        SharedErrorPath(SharedErrorPath&&) = default;
+        ~SharedErrorPath();
+
+        SharedErrorPath& operator=(const SharedErrorPath& other);
+        SharedErrorPath& operator=(SharedErrorPath&& other) noexcept;
+        SharedErrorPath& operator=(const ErrorPath& errorPath);
+
+        bool empty() const {
+            return !mLast;
+        }
+
+        std::size_t size() const {
+            return mLast ? mLast->size : 0;
+        }
+
+        void clear() {
+            *this = SharedErrorPath();
+        }
+
+        const Token* backToken() const;
+        const std::string& backInfo() const;
+
+        void emplace_back(const Token* tok, std::string info);
+        void emplace_front(const Token* tok, std::string info);
+
+        /** Add the items of a path at the end, the items are shared if this path is empty */
+        void append(const SharedErrorPath& errorPath);
+        void append(const ErrorPath& errorPath);
+        /** Add the items of a path at the beginning */
+        void prepend(const ErrorPath& errorPath);
+
+        /** Call f(token, info) for each item from first to last */
+        template<class F>
+        void forEach(F f) const {
+            for (const Node* node : nodes())
+                f(node->token, *node->info);
+        }
+
+        ErrorPath toList() const;
+
+    private:
+        struct Node {
+            std::shared_ptr<Node> previous;
+            const Token* token;
+            std::shared_ptr<const std::string> info;
+            std::size_t size;
+        };
+
+        /** The items from first to last */
+        std::vector<const Node*> nodes() const;
+
+        void push(const Token* tok, std::shared_ptr<const std::string> info);
+
+        std::shared_ptr<Node> mLast;
+    };
+
     class CPPCHECKLIB Value {
     public:
         enum class Bound : std::uint8_t { Upper, Lower, Point };
@@ -331,9 +400,22 @@ namespace ValueFlow
         /** Condition that this value depends on */
         const Token* condition{};
 
-        ErrorPath errorPath;
+        SharedErrorPath errorPath;
 
-        ErrorPath debugPath; // TODO: make lighter by default
+    private:
+        /** Data which only few values have */
+        struct Extra {
+            /** Where the value was set, only collected with --debug-normal */
+            ErrorPath debugPath;
+            /** The uninitialized members of a partially initialized variable */
+            std::vector<std::string> subexpressions;
+        };
+        /** Shared by the copies of the value until one of them modifies it */
+        std::shared_ptr<Extra> mExtra;
+
+        Extra& extra();
+
+    public:
 
         /** For calculated values - varId that calculated value depends on */
         nonneg int varId{};
@@ -354,11 +436,16 @@ namespace ValueFlow
         /** int value before implicit truncation */
         MathLib::bigint wideintvalue{};
 
-        std::vector<std::string> subexpressions;
-
         // Set to where a lifetime is captured by value
         const Token* capturetok{};
 
+        const ErrorPath& debugPath() const;
+        void addDebugPath(ErrorPathItem item);
+
+        const std::vector<std::string>& subexpressions() const;
+        void addSubexpression(std::string subexpression);
+        void clearSubexpressions();
+
         RET_NONNULL static const char* toString(MoveKind moveKind);
         RET_NONNULL static const char* toString(LifetimeKind lifetimeKind);
         RET_NONNULL static const char* toString(LifetimeScope lifetimeScope);
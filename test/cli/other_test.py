@@ -1044,10 +1044,13 @@ def test_showtime_top5_summary_compdb(tmp_path):
 
 
 def __test_showtime_file(tmp_path, use_compdb=False, use_addons=False, use_clang_tidy=False):
-    exp_res = 79
+    exp_res = 78
     # project analysis does not call Preprocessor::getConfig()
     if use_compdb:
         exp_res -= 1
+    # the addons need the values of moved variables
+    if use_addons:
+        exp_res += 1
     __test_showtime(tmp_path, 'file', exp_res, 'Check time: ', use_compdb=use_compdb, use_addons=use_addons, use_clang_tidy=use_clang_tidy)
 
 
@@ -1078,10 +1081,13 @@ def test_showtime_file_clang_tidy_compdb(tmp_path):
 
 
 def __test_showtime_summary(tmp_path, use_compdb=False, use_addons=False, use_clang_tidy=False):
-    exp_res = 79
+    exp_res = 78
     # project analysis does not call Preprocessor::getConfig()
     if use_compdb:
         exp_res -= 1
+    # the addons need the values of moved variables
+    if use_addons:
+        exp_res += 1
     __test_showtime(tmp_path, 'summary', exp_res, 'Overall time: ', use_compdb=use_compdb, use_addons=use_addons, use_clang_tidy=use_clang_tidy)
 
 
@@ -1123,6 +1129,57 @@ def test_showtime_file_total_compdb(tmp_path):
     __test_showtime_file_total(tmp_path, True)
 
 
+@pytest.mark.parametrize("extra_args,moved_expected", [([], False), (['--enable=warning'], True), (['--enable=warning', '--std=c++03'], False), (['--dump'], True)])
+def test_valueflow_products(tmp_path, extra_args, moved_expected):
+    test_file = tmp_path / 'test.cpp'
+    with open(test_file, 'wt') as f:
+        f.write(
+"""
+void f(P p)
+{
+    g(std::move(p));
+}
+""")
+
+    args = [
+        '--showtime=summary',
+        '--quiet',
+        str(test_file)
+    ] + extra_args
+
+    exitcode, stdout, stderr = cppcheck(args)
+    assert exitcode == 0, stdout if stdout else stderr
+    assert ('valueFlowAfterMove' in stdout) == moved_expected
+    assert 'valueFlowAfterAssign' in stdout
+    assert stderr == ''
+
+
+def test_valueflow_products_unused_function_only(tmp_path):
+    test_file = tmp_path / 'test.cpp'
+    with open(test_file, 'wt') as f:
+        f.write(
+"""
+void f(P p)
+{
+    g(std::move(p));
+}
+""")
+
+    args = [
+        '--showtime=summary',
+        '--quiet',
+        str(test_file)
+    ]
+
+    env = os.environ.copy()
+    env['UNUSEDFUNCTION_ONLY'] = '1'
+    exitcode, stdout, stderr = cppcheck(args, env=env)
+    assert exitcode == 0, stdout if stdout else stderr
+    assert 'Tokenizer::simplifyTokens1::ValueFlow' not in stdout
+    assert 'Tokenizer::simplifyTokens1::createSymbolDatabase' in stdout
+    assert stderr == ''
+
+
 def test_showtime_unique(tmp_path):
     test_file = tmp_path / 'test.cpp'
     with open(test_file, 'wt') as f:
@@ -4494,7 +4551,7 @@ def test_analyzerinfo(tmp_path):
 
     # cached results
     run_and_assert_cppcheck([
-        "skipping analysis - loaded 1 cached finding(s) from '{}' for '{}'".format(test_a1_file_s, test_file_s)
+        "skipping analysis - loaded 1 cached finding(s) from '{}' for '{}' (dependencies unchanged)".format(test_a1_file_s, test_file_s)
     ])
 
     # modified file
@@ -4502,6 +4559,7 @@ def test_analyzerinfo(tmp_path):
         f.write('\n#define DEF')
 
     run_and_assert_cppcheck([
+        "cannot skip reading '{}' using the dependencies from '{}' - '{}' has been modified".format(test_file_s, test_a1_file_s, test_file_s),
         "discarding cached result from '{}' for '{}' - hash mismatch".format(test_a1_file_s, test_file_s)
     ])
 
@@ -4550,6 +4608,138 @@ def test_analyzerinfo(tmp_path):
     # - internalError
 
 
+def test_analyzerinfo_dependencies(tmp_path):
+    test_file = tmp_path / 'test.c'
+    with open(test_file, "w") as f:
+        f.write(
+"""#include "test.h"
+void f()
+{
+    (void)(*((int*)P));
+}
+""")
+
+    inc_dir = tmp_path / 'inc'
+    os.makedirs(inc_dir)
+
+    test_h_file = tmp_path / 'test.h'
+    with open(test_h_file, "w") as f:
+        f.write('#define P 0\n')
+
+    build_dir = tmp_path / 'b1'
+    os.makedirs(build_dir)
+
+    args = [
+        '-q',
+        '--debug-analyzerinfo',
+        '--template=simple',
+        '--cppcheck-build-dir={}'.format(build_dir),
+        '-I{}'.format(inc_dir),
+        str(test_file)
+    ]
+
+    test_file_s = str(test_file).replace('\\', '/')
+    test_h_file_s = str(test_h_file).replace('\\', '/')
+    test_a1_file_s = str(build_dir / 'test.a1').replace('\\', '/')
+
+    def run_and_assert_cppcheck(stdout_exp, stderr_exp):
+        exitcode, stdout, stderr = cppcheck(args)
+        assert exitcode == 0, stdout
+        assert stdout.splitlines() == stdout_exp
+        assert stderr.splitlines() == stderr_exp
+
+    null_pointer = '{}:4:14: error: Null pointer dereference: (int*)0 [nullPointer]'.format(test_file)
+
+    run_and_assert_cppcheck([
+        "no cached result '{}' for '{}' found".format(test_a1_file_s, test_file_s)
+    ], [null_pointer])
+
+    # nothing changed - the file is not read
+    run_and_assert_cppcheck([
+        "skipping analysis - loaded 1 cached finding(s) from '{}' for '{}' (dependencies unchanged)".format(test_a1_file_s, test_file_s)
+    ], [null_pointer])
+
+    # modified header which is not part of the hash
+    with open(test_h_file, "w") as f:
+        f.write('#define P 1\n')
+
+    run_and_assert_cppcheck([
+        "cannot skip reading '{}' using the dependencies from '{}' - '{}' has been modified".format(test_file_s, test_a1_file_s, test_h_file_s),
+        "discarding cached result from '{}' for '{}' - '{}' has been modified".format(test_a1_file_s, test_file_s, test_h_file_s)
+    ], [])
+
+    # the header is found in the include path instead
+    with open(inc_dir / 'test.h', "w") as f:
+        f.write('#define P 0\n')
+    os.remove(test_h_file)
+
+    run_and_assert_cppcheck([
+        "cannot skip reading '{}' using the dependencies from '{}' - '{}' has been removed".format(test_file_s, test_a1_file_s, test_h_file_s),
+        "discarding cached result from '{}' for '{}' - '{}' has been removed".format(test_a1_file_s, test_file_s, test_h_file_s)
+    ], [null_pointer])
+
+    # a header which is found first is added
+    with open(test_h_file, "w") as f:
+        f.write('#define P 1\n')
+
+    run_and_assert_cppcheck([
+        "cannot skip reading '{}' using the dependencies from '{}' - '{}' has been created".format(test_file_s, test_a1_file_s, test_h_file_s),
+        "discarding cached result from '{}' for '{}' - '{}' has been created".format(test_a1_file_s, test_file_s, test_h_file_s)
+    ], [])
+
+
+def test_analyzerinfo_binary(tmp_path):
+    test_file = tmp_path / 'test.c'
+    with open(test_file, "w") as f:
+        f.write(
+"""void f(int *p)
+{
+    *p = 0;
+}
+void g()
+{
+    f(0);
+}
+""")
+
+    build_dir = tmp_path / 'b1'
+    os.makedirs(build_dir)
+
+    args = [
+        '-q',
+        '--template=simple',
+        '--cppcheck-build-dir={}'.format(build_dir),
+        '--cppcheck-build-dir-format=binary',
+        '--enable=all',
+        '-j2',
+        str(test_file)
+    ]
+
+    stderr_exp = [
+        '{}:3:6: warning: Possible null pointer dereference: p [nullPointer]'.format(test_file),
+        "{}:5:6: style: The function 'g' is never used. [unusedFunction]".format(test_file),
+        '{}:3:6: error: Null pointer dereference: p [ctunullpointer]'.format(test_file)
+    ]
+
+    for _ in range(2):
+        exitcode, stdout, stderr = cppcheck(args)
+        assert exitcode == 0, stdout
+        assert stdout == ''
+        assert sorted(stderr.splitlines()) == sorted(stderr_exp)
+
+    test_a1_file = build_dir / 'test.a1'
+    with open(test_a1_file, 'rb') as f:
+        assert f.read(8) == b'CPPCHKAI'
+
+    exitcode, stdout, stderr = cppcheck(['--export-analyzerinfo={}'.format(test_a1_file)])
+    assert exitcode == 0, stderr
+    assert stderr == ''
+    root = ElementTree.fromstring(stdout)
+    assert root.tag == 'analyzerinfo'
+    assert root.get('hash') is not None
+    assert sorted([e.get('check') for e in root.findall('FileInfo')]) == ['CheckUnusedFunctions', 'Null pointer', 'ctu']
+
+
 def test_ctu_function_call_path_slash(tmp_path):  # #14591
     test_file = tmp_path / 'test.cpp'
     with open(test_file, "w") as f:
@@ -438,3 +438,30 @@ def test_slow_many_headers(tmpdir):
     cppcheck(['-DCONFIG0', c_file])
     end = time.perf_counter_ns()
     assert end - start < 2 * 10**9 # max 2 sec
+
+
+@pytest.mark.skipif(sys.platform == 'win32', reason="requires ProcessExecutor")
+@pytest.mark.timeout(60)
+def test_process_executor_many_findings(tmpdir):
+    # all the findings of the child processes need to be transferred to the main process
+    n_files = 4
+    n_findings = 1000
+    for i in range(n_files):
+        filename = os.path.join(tmpdir, f'test{i}.c')
+        with open(filename, 'wt') as f:
+            for j in range(n_findings):
+                f.write(f'void f{j}(void) {{ int x; (void)(x + {j}); }}\n')
+    args = [
+        '-q',
+        '-j2',
+        '--executor=process',
+        '--template={file}:{line}:{id}',
+        '--showtime=summary',
+        str(tmpdir)
+    ]
+    exitcode, stdout, stderr = cppcheck(args)
+    assert exitcode == 0, stdout
+    lines = stderr.splitlines()
+    assert len(lines) == n_files * n_findings
+    assert len(set(lines)) == n_files * n_findings
+    assert 'Overall time:' in stdout
@@ -19,12 +19,18 @@
 
 #include "analyzerinfo.h"
 #include "errorlogger.h"
+#include "errortypes.h"
 #include "filesettings.h"
 #include "fixture.h"
+#include "helpers.h"
 #include "standards.h"
 
+#include <cstdio>
+#include <fstream>
 #include <list>
+#include <set>
 #include <sstream>
+#include <string>
 
 #include "xml.h"
 
@@ -45,6 +51,8 @@ private:
         TEST_CASE(filesTextDuplicateFile);
         TEST_CASE(parse);
         TEST_CASE(skipAnalysis);
+        TEST_CASE(dependencies);
+        TEST_CASE(binary);
     }
 
     void getAnalyzerInfoFileFromFilesTxt() const {
@@ -268,6 +276,128 @@ private:
             ASSERT_EQUALS(0, errorList.size());
         }
     }
+
+    static std::string checkDependencies(const std::string &dependenciesXml, bool sourceFile) {
+        tinyxml2::XMLDocument doc;
+        const std::string xml = "<?xml version=\"1.0\"?><analyzerinfo hash=\"100\">" + dependenciesXml + "</analyzerinfo>";
+        if (doc.Parse(xml.c_str()) != tinyxml2::XML_SUCCESS)
+            return "invalid xml";
+        return AnalyzerInformationTest::checkDependencies(doc.FirstChildElement()->FirstChildElement("dependencies"), sourceFile);
+    }
+
+    void dependencies() const {
+        const ScopedFile source("dep.c", "#include \"dep.h\"\n");
+        const ScopedFile header("dep.h", "int x;\n");
+
+        const std::string xml = AnalyzerInformationTest::getDependenciesXml(1, source.path(), {header.path()}, {"dep_missing.h"});
+        ASSERT(xml.find("toolinfo=\"1\"") != std::string::npos);
+        ASSERT_EQUALS("", checkDependencies(xml, false));
+        ASSERT_EQUALS("", checkDependencies(xml, true));
+
+        // the analyzed file is required to reuse the results without reading it
+        const std::string xmlNoSource = AnalyzerInformationTest::getDependenciesXml(1, "", {header.path()}, {});
+        ASSERT_EQUALS("", checkDependencies(xmlNoSource, false));
+        ASSERT_EQUALS("file is not a dependency", checkDependencies(xmlNoSource, true));
+
+        ASSERT_EQUALS("no dependencies found", checkDependencies("", false));
+        ASSERT_EQUALS("'dep_removed.h' has been removed", checkDependencies("<dependencies><file name=\"dep_removed.h\" mtime=\"0\" size=\"0\" hash=\"0\"/></dependencies>", false));
+
+        // same size - detected using the content
+        {
+            std::ofstream fout(header.path());
+            fout << "int y;\n";
+        }
+        ASSERT_EQUALS("'" + header.path() + "' has been modified", checkDependencies(xml, false));
+
+        {
+            std::ofstream fout(header.path());
+            fout << "int x;\n";
+        }
+        ASSERT_EQUALS("", checkDependencies(xml, false));
+
+        {
+            std::ofstream fout(header.path());
+            fout << "int xyz;\n";
+        }
+        ASSERT_EQUALS("'" + header.path() + "' has been modified", checkDependencies(xml, false));
+
+        // a file which was not found before would be included now
+        const ScopedFile created("dep_missing.h", "");
+        const std::string xml2 = AnalyzerInformationTest::getDependenciesXml(1, source.path(), {}, {"dep_missing.h"});
+        ASSERT_EQUALS("'dep_missing.h' has been created", checkDependencies(xml2, false));
+    }
+
+    void binary() const {
+        const std::string analyzerInfoFile = AnalyzerInformation::getAnalyzerInfoFile(".", "binary.c", "", 0);
+
+        std::list<ErrorMessage::FileLocation> locs{ErrorMessage::FileLocation("binary.c", 4, 3)};
+        const ErrorMessage msg(std::move(locs), "", Severity::error, "Null pointer dereference", "nullPointer", Certainty::normal);
+
+        {
+            AnalyzerInformation analyzerInfo(true);
+            std::list<ErrorMessage> errors;
+            ASSERT(analyzerInfo.analyzeFile(".", "binary.c", "", 0, 100, errors));
+            analyzerInfo.reportErr(msg);
+            analyzerInfo.setFileInfo("ctu", "    <function-call/>\n");
+            analyzerInfo.setDependencies(1, "", {}, {});
+            analyzerInfo.close();
+        }
+
+        {
+            AnalyzerInformation analyzerInfo(true);
+            std::list<ErrorMessage> errors;
+            ASSERT(analyzerInfo.analyzeFile(".", "binary.c", "", 0, 99, errors));
+            ASSERT_EQUALS(0, errors.size());
+            // the file is rewritten when closed
+            analyzerInfo.reportErr(msg);
+            analyzerInfo.reportErr(msg);
+            analyzerInfo.setFileInfo("ctu", "    <function-call/>\n");
+            analyzerInfo.setDependencies(1, "", {}, {});
+            analyzerInfo.close();
+        }
+
+        {
+            AnalyzerInformation analyzerInfo;
+            std::list<ErrorMessage> errors;
+            ASSERT(!analyzerInfo.analyzeFile(".", "binary.c", "", 0, 99, errors));
+            ASSERT_EQUALS(2, errors.size());
+            ASSERT_EQUALS(msg.toXML(), errors.front().toXML());
+        }
+
+        std::string xml;
+        ASSERT_EQUALS("", AnalyzerInformation::exportXml(analyzerInfoFile, xml));
+        ASSERT_EQUALS("<?xml version=\"1.0\"?>\n"
+                      "<analyzerinfo hash=\"99\">\n" +
+                      msg.toXML() + "\n" +
+                      msg.toXML() + "\n"
+                      "  <FileInfo check=\"ctu\">\n"
+                      "    <function-call/>\n"
+                      "  </FileInfo>\n"
+                      "  <dependencies toolinfo=\"1\">\n"
+                      "  </dependencies>\n"
+                      "</analyzerinfo>\n", xml);
+
+        // the exported XML can be used instead
+        {
+            std::ofstream fout(analyzerInfoFile);
+            fout << xml;
+        }
+        {
+            AnalyzerInformation analyzerInfo;
+            std::list<ErrorMessage> errors;
+            ASSERT(!analyzerInfo.analyzeFile(".", "binary.c", "", 0, 99, errors));
+            ASSERT_EQUALS(2, errors.size());
+        }
+
+        // truncated file
+        {
+            std::ofstream fout(analyzerInfoFile);
+            fout << "CPPCHKAI";
+        }
+        ASSERT_EQUALS("failed to load '" + analyzerInfoFile + "' (Internal Error: Binary deserialization failed - premature end of data)", AnalyzerInformation::exportXml(analyzerInfoFile, xml));
+
+        std::remove(analyzerInfoFile.c_str());
+    }
 };
 
 REGISTER_TEST(TestAnalyzerInformation)
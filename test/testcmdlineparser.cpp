@@ -368,13 +368,28 @@ private:
         TEST_CASE(checksMaxTime);
         TEST_CASE(checksMaxTime2);
         TEST_CASE(checksMaxTimeInvalid);
+        TEST_CASE(configJobs);
+        TEST_CASE(configJobsZero);
+        TEST_CASE(configJobsTooBig);
+        TEST_CASE(configJobsInvalid);
+        TEST_CASE(functionJobs);
+        TEST_CASE(functionJobsZero);
+        TEST_CASE(functionJobsTooBig);
+        TEST_CASE(functionJobsInvalid);
 #ifdef HAS_THREADING_MODEL_FORK
         TEST_CASE(loadAverage);
         TEST_CASE(loadAverage2);
         TEST_CASE(loadAverageInvalid);
+        TEST_CASE(processMaxFiles);
+        TEST_CASE(processMaxFilesUnlimited);
+        TEST_CASE(processMaxFilesInvalid);
 #else
         TEST_CASE(loadAverageNotSupported);
+        TEST_CASE(processMaxFilesNotSupported);
 #endif
+        TEST_CASE(headerCacheSize);
+        TEST_CASE(headerCacheSizeDisabled);
+        TEST_CASE(headerCacheSizeInvalid);
         TEST_CASE(maxCtuDepth);
         TEST_CASE(maxCtuDepth2);
         TEST_CASE(maxCtuDepthLimit);
@@ -535,6 +550,9 @@ private:
         TEST_CASE(cppcheckBuildDirNonExistent);
         TEST_CASE(cppcheckBuildDirEmpty);
         TEST_CASE(cppcheckBuildDirMultiple);
+        TEST_CASE(cppcheckBuildDirFormat);
+        TEST_CASE(cppcheckBuildDirFormatInvalid);
+        TEST_CASE(exportAnalyzerInfoMissing);
         TEST_CASE(noCppcheckBuildDir);
         TEST_CASE(noCppcheckBuildDir2);
 
@@ -2448,6 +2466,62 @@ private:
         ASSERT_EQUALS("cppcheck: error: argument to '--checks-max-time=' is not valid - not an integer (invalid_argument).\n", logger->str());
     }
 
+    void configJobs() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--config-jobs=4", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parseFromArgs(argv));
+        ASSERT_EQUALS(4, settings->configJobs);
+    }
+
+    void configJobsZero() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--config-jobs=0", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: argument for '--config-jobs=' must be greater than 0.\n", logger->str());
+    }
+
+    void configJobsTooBig() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--config-jobs=1025", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: argument for '--config-jobs=' is allowed to be 1024 at max.\n", logger->str());
+    }
+
+    void configJobsInvalid() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--config-jobs=one", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: argument to '--config-jobs=' is not valid - not an integer (invalid_argument).\n", logger->str());
+    }
+
+    void functionJobs() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--function-jobs=4", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parseFromArgs(argv));
+        ASSERT_EQUALS(4, settings->vfOptions.functionJobs);
+    }
+
+    void functionJobsZero() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--function-jobs=0", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: argument for '--function-jobs=' must be greater than 0.\n", logger->str());
+    }
+
+    void functionJobsTooBig() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--function-jobs=1025", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: argument for '--function-jobs=' is allowed to be 1024 at max.\n", logger->str());
+    }
+
+    void functionJobsInvalid() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--function-jobs=one", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: argument to '--function-jobs=' is not valid - not an integer (invalid_argument).\n", logger->str());
+    }
+
 #ifdef HAS_THREADING_MODEL_FORK
     void loadAverage() {
         REDIRECT;
@@ -2469,6 +2543,28 @@ private:
         ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
         ASSERT_EQUALS("cppcheck: error: argument to '-l' is not valid - not an integer (invalid_argument).\n", logger->str());
     }
+
+    void processMaxFiles() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--process-max-files=100", "file.cpp"};
+        ASSERT_EQUALS(1, settings->processMaxFiles);
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parseFromArgs(argv));
+        ASSERT_EQUALS(100, settings->processMaxFiles);
+    }
+
+    void processMaxFilesUnlimited() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--process-max-files=0", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parseFromArgs(argv));
+        ASSERT_EQUALS(0, settings->processMaxFiles);
+    }
+
+    void processMaxFilesInvalid() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--process-max-files=one", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: argument to '--process-max-files=' is not valid - not an integer (invalid_argument).\n", logger->str());
+    }
 #else
     void loadAverageNotSupported() {
         REDIRECT;
@@ -2476,8 +2572,37 @@ private:
         ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
         ASSERT_EQUALS("cppcheck: error: Option -l cannot be used as Cppcheck has not been built with fork threading model.\n", logger->str());
     }
+
+    void processMaxFilesNotSupported() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--process-max-files=100", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: Option --process-max-files cannot be used as Cppcheck has not been built with fork threading model.\n", logger->str());
+    }
 #endif
 
+    void headerCacheSize() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--header-cache-size=16", "file.cpp"};
+        ASSERT_EQUALS(256, settings->headerCacheSize);
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parseFromArgs(argv));
+        ASSERT_EQUALS(16, settings->headerCacheSize);
+    }
+
+    void headerCacheSizeDisabled() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--header-cache-size=0", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parseFromArgs(argv));
+        ASSERT_EQUALS(0, settings->headerCacheSize);
+    }
+
+    void headerCacheSizeInvalid() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--header-cache-size=-1", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: argument to '--header-cache-size=' is not valid - needs to be positive.\n", logger->str());
+    }
+
     void maxCtuDepth() {
         REDIRECT;
         const char * const argv[] = {"cppcheck", "--max-ctu-depth=5", "file.cpp"};
@@ -3737,6 +3862,27 @@ private:
         ASSERT_EQUALS(".", settings->buildDir);
     }
 
+    void cppcheckBuildDirFormat() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--cppcheck-build-dir-format=binary", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parseFromArgs(argv));
+        ASSERT_EQUALS_ENUM(Settings::BuildDirFormat::BINARY, settings->buildDirFormat);
+    }
+
+    void cppcheckBuildDirFormatInvalid() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--cppcheck-build-dir-format=json", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: unknown '--cppcheck-build-dir-format' value 'json'.\n", logger->str());
+    }
+
+    void exportAnalyzerInfoMissing() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--export-analyzerinfo=missing.a1"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: 'missing.a1' not found\n", logger->str());
+    }
+
     void noCppcheckBuildDir()
     {
         REDIRECT;
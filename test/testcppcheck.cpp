@@ -23,6 +23,7 @@
 #include "errortypes.h"
 #include "filesettings.h"
 #include "fixture.h"
+#include "headercache.h"
 #include "helpers.h"
 #include "path.h"
 #include "preprocessor.h"
@@ -84,6 +85,10 @@ private:
         TEST_CASE(checkPlistOutput);
         TEST_CASE(premiumResultsCache);
         TEST_CASE(purgedConfiguration);
+        TEST_CASE(purgedConfigurationConfigJobs);
+        TEST_CASE(configJobs);
+        TEST_CASE(functionJobs);
+        TEST_CASE(headerCache);
     }
 
     void getErrorMessages() const {
@@ -621,6 +626,181 @@ private:
                       it->toString(false, templateFormat, ""));
     }
 
+    void purgedConfigurationConfigJobs() const
+    {
+        ScopedFile test_file("test.cpp",
+                             "#ifdef X\n"
+                             "#endif\n"
+                             "int main() {}\n");
+
+        // this is the "simple" format
+        const auto s = dinit(Settings,
+                             $.templateFormat = templateFormat, // TODO: remove when we only longer rely on toString() in unique message handling
+                                 $.severity.enable (Severity::information);
+                             $.debugwarnings = true,
+                             $.configJobs = 2);
+        Suppressions supprs;
+        ErrorLogger2 errorLogger;
+        CppCheck cppcheck(s, supprs, errorLogger, nullptr, false, {});
+        ASSERT_EQUALS(1, cppcheck.check(FileWithDetails(test_file.path(), Path::identify(test_file.path(), false), 0)));
+        // TODO: how to properly disable these warnings?
+        errorLogger.errmsgs.erase(std::remove_if(errorLogger.errmsgs.begin(), errorLogger.errmsgs.end(), [](const ErrorMessage& msg) {
+            return msg.id == "logChecker";
+        }), errorLogger.errmsgs.end());
+        ASSERT_EQUALS(1, errorLogger.errmsgs.size());
+        auto it = errorLogger.errmsgs.cbegin();
+        ASSERT_EQUALS("test.cpp:0:0: information: The configuration 'X=X' was not checked because its code equals another one. [purgedConfiguration]",
+                      it->toString(false, templateFormat, ""));
+    }
+
+    std::vector<std::string> checkConfigs(const std::string &path, unsigned int configJobs) const
+    {
+        // this is the "simple" format
+        const auto s = dinit(Settings,
+                             $.templateFormat = templateFormat, // TODO: remove when we only longer rely on toString() in unique message handling
+                             $.configJobs = configJobs);
+        Suppressions supprs;
+        ErrorLogger2 errorLogger;
+        CppCheck cppcheck(s, supprs, errorLogger, nullptr, false, {});
+        (void)cppcheck.check(FileWithDetails(path, Path::identify(path, false), 0));
+        std::vector<std::string> ret;
+        for (const ErrorMessage &msg : errorLogger.errmsgs) {
+            // TODO: how to properly disable these warnings?
+            if (msg.id != "logChecker")
+                ret.push_back(msg.toString(false, templateFormat, ""));
+        }
+        return ret;
+    }
+
+    void configJobs() const
+    {
+        ScopedFile test_file("test.c",
+                             "#ifdef A\n"
+                             "void a() { (void)(*((int*)0)); }\n"
+                             "#endif\n"
+                             "#ifdef B\n"
+                             "void b() { (void)(*((int*)0)); }\n"
+                             "#endif\n"
+                             "#ifdef C\n"
+                             "#endif\n"
+                             "void f() { (void)(*((int*)0)); }\n");
+
+        const std::vector<std::string> expected = checkConfigs(test_file.path(), 1);
+        ASSERT_EQUALS(3, expected.size());
+        ASSERT_EQUALS("test.c:9:21: error: Null pointer dereference: (int*)0 [nullPointer]", expected[0]);
+        ASSERT_EQUALS("test.c:2:21: error: Null pointer dereference: (int*)0 [nullPointer]", expected[1]);
+        ASSERT_EQUALS("test.c:5:21: error: Null pointer dereference: (int*)0 [nullPointer]", expected[2]);
+
+        // the results are reported in the same order regardless of the amount of threads
+        ASSERT(expected == checkConfigs(test_file.path(), 2));
+        ASSERT(expected == checkConfigs(test_file.path(), 4));
+    }
+
+    std::vector<std::string> checkFunctions(const std::string &path, unsigned int functionJobs) const
+    {
+        // this is the "simple" format
+        auto s = dinit(Settings,
+                       $.templateFormat = templateFormat, // TODO: remove when we only longer rely on toString() in unique message handling
+                       $.debugwarnings = true);
+        s.severity.enable(Severity::warning);
+        s.vfOptions.functionJobs = functionJobs;
+        Suppressions supprs;
+        ErrorLogger2 errorLogger;
+        CppCheck cppcheck(s, supprs, errorLogger, nullptr, false, {});
+        (void)cppcheck.check(FileWithDetails(path, Path::identify(path, false), 0));
+        std::vector<std::string> ret;
+        for (const ErrorMessage &msg : errorLogger.errmsgs) {
+            // TODO: how to properly disable these warnings?
+            if (msg.id != "logChecker")
+                ret.push_back(msg.toString(false, templateFormat, ""));
+        }
+        return ret;
+    }
+
+    void functionJobs() const
+    {
+        ScopedFile test_file("test.cpp",
+                             "int a(int x) {\n"
+                             "    int *p = nullptr;\n"
+                             "    if (x == 1) {}\n"
+                             "    return x == 1 ? *p : 0;\n"
+                             "}\n"
+                             "int b(int y) {\n"
+                             "    int z = y;\n"
+                             "    if (z > 10)\n"
+                             "        return 10 / (y - 11);\n"
+                             "    return 100 / (z - 5);\n"
+                             "}\n"
+                             "void c() {\n"
+                             "    struct S {\n"
+                             "        int f(int i) { int *q = nullptr; if (i) {} return i ? 0 : *q; }\n"
+                             "    };\n"
+                             "    auto l = [](int i) { int d = 0; return i / d; };\n"
+                             "    (void)l(S().f(1));\n"
+                             "}\n"
+                             "#define M if (w == 123) {}\n"
+                             "void d(int w) {\n"
+                             "    g = w;\n"
+                             "    M;\n"
+                             "}\n");
+
+        const std::vector<std::string> expected = checkFunctions(test_file.path(), 1);
+        ASSERT(expected.size() > 3);
+
+        // the results are the same and reported in the same order regardless of the amount of threads
+        ASSERT(expected == checkFunctions(test_file.path(), 2));
+        ASSERT(expected == checkFunctions(test_file.path(), 4));
+    }
+
+    std::vector<std::string> checkWithHeaderCache(const std::string &path, HeaderCache &headerCache) const
+    {
+        const auto s = dinit(Settings,
+                             $.templateFormat = templateFormat, // TODO: remove when we only longer rely on toString() in unique message handling
+                             $.inlineSuppressions = true);
+        Suppressions supprs;
+        ErrorLogger2 errorLogger;
+        CppCheck cppcheck(s, supprs, errorLogger, nullptr, false, {});
+        cppcheck.setHeaderCache(&headerCache);
+        (void)cppcheck.check(FileWithDetails(path, Path::identify(path, false), 0));
+        std::vector<std::string> ret;
+        for (const ErrorMessage &msg : errorLogger.errmsgs) {
+            // TODO: how to properly disable these warnings?
+            if (msg.id != "logChecker")
+                ret.push_back(msg.toString(false, templateFormat, ""));
+        }
+        return ret;
+    }
+
+    void headerCache() const
+    {
+        ScopedFile header_file("header_cache.h",
+                               "void h1() { (void)(*((int*)0)); }\n"
+                               "// cppcheck-suppress nullPointer\n"
+                               "void h2() { (void)(*((int*)0)); }\n");
+        ScopedFile test_file1("header_cache1.c",
+                              "#include \"header_cache.h\"\n"
+                              "void f1() { (void)(*((int*)0)); }\n");
+        ScopedFile test_file2("header_cache2.c",
+                              "int x;\n"
+                              "#include \"header_cache.h\"\n");
+
+        HeaderCache headerCache(1024 * 1024);
+
+        const std::vector<std::string> errors1 = checkWithHeaderCache(test_file1.path(), headerCache);
+        ASSERT_EQUALS(2, errors1.size());
+        ASSERT_EQUALS("header_cache.h:1:22: error: Null pointer dereference: (int*)0 [nullPointer]", errors1[0]);
+        ASSERT_EQUALS("header_cache1.c:2:22: error: Null pointer dereference: (int*)0 [nullPointer]", errors1[1]);
+        ASSERT_EQUALS(0, headerCache.hits());
+        ASSERT_EQUALS(1, headerCache.misses());
+
+        // the header is not read again and the inline suppression still applies
+        const std::vector<std::string> errors2 = checkWithHeaderCache(test_file2.path(), headerCache);
+        ASSERT_EQUALS(1, errors2.size());
+        ASSERT_EQUALS("header_cache.h:1:22: error: Null pointer dereference: (int*)0 [nullPointer]", errors2[0]);
+        ASSERT_EQUALS(1, headerCache.hits());
+        ASSERT_EQUALS(1, headerCache.misses());
+    }
+
     // TODO: test suppressions
     // TODO: test all with FS
 };
@@ -16,6 +16,7 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include "binarystream.h"
 #include "checkers.h"
 #include "cppcheck.h"
 #include "errorlogger.h"
@@ -74,6 +75,9 @@ private:
         TEST_CASE(SerializeSanitize);
         TEST_CASE(SerializeFileLocation);
         TEST_CASE(SerializeAndDeserialize);
+        TEST_CASE(SerializeBinary);
+        TEST_CASE(SerializeBinaryInterned);
+        TEST_CASE(DeserializeBinaryInvalidInput);
 
         TEST_CASE(substituteTemplateFormatStatic);
         TEST_CASE(substituteTemplateLocationStatic);
@@ -710,6 +714,87 @@ private:
         ASSERT_EQUALS(msg.symbolNames(), msg2.symbolNames());
     }
 
+    void SerializeBinary() const {
+        ErrorMessage::FileLocation loc1(":/,;", "abcd:/,", 654, 33);
+        loc1.setfile("[]:;,()");
+        ErrorMessage::FileLocation loc2("foo.cpp", "", -1, 0);
+
+        ErrorMessage msg({std::move(loc1), std::move(loc2)}, "", Severity::warning, "$symbol:var\nmessage $symbol\nverbose \x01", "id", CWE(398), Certainty::inconclusive);
+        msg.remark = "some remark";
+        msg.file0 = "test.cpp";
+        msg.hash = static_cast<std::size_t>(0xfedcba9876543210ULL);
+
+        BinaryWriter writer;
+        msg.serialize(writer);
+
+        BinaryReader reader;
+        reader.setData(writer.data().data(), writer.data().size());
+        ErrorMessage msg2;
+        ASSERT_NO_THROW(msg2.deserialize(reader));
+        ASSERT(reader.atEnd());
+
+        // the binary and the text serialization need to carry the same data
+        ASSERT_EQUALS(msg.serialize(), msg2.serialize());
+        ASSERT_EQUALS(2, msg2.callStack.size());
+        ASSERT_EQUALS("[]:;,()", msg2.callStack.front().getfile(false));
+        ASSERT_EQUALS(":/,;", msg2.callStack.front().getOrigFile(false));
+        ASSERT_EQUALS(654, msg2.callStack.front().line);
+        ASSERT_EQUALS(33, msg2.callStack.front().column);
+        ASSERT_EQUALS("abcd:/,", msg2.callStack.front().getinfo());
+        ASSERT_EQUALS(-1, msg2.callStack.back().line);
+        ASSERT_EQUALS(398, msg2.cwe.id);
+        ASSERT_EQUALS(msg.hash, msg2.hash);
+        ASSERT_EQUALS_ENUM(Certainty::inconclusive, msg2.certainty);
+        ASSERT_EQUALS(msg.symbolNames(), msg2.symbolNames());
+    }
+
+    void SerializeBinaryInterned() const {
+        ErrorMessage msg({fooCpp5, barCpp8}, "test.cpp", Severity::error, "Programming error.", "errorId", Certainty::normal);
+
+        BinaryWriter writer;
+        msg.serialize(writer);
+        const std::string first = writer.data();
+        writer.clear();
+        msg.serialize(writer);
+        const std::string second = writer.data();
+
+        // strings are only transferred once
+        ASSERT(second.size() < first.size());
+        ASSERT_EQUALS(std::string::npos, second.find("Programming error."));
+
+        BinaryReader reader;
+        ErrorMessage msg2;
+        reader.setData(first.data(), first.size());
+        ASSERT_NO_THROW(msg2.deserialize(reader));
+        ErrorMessage msg3;
+        reader.setData(second.data(), second.size());
+        ASSERT_NO_THROW(msg3.deserialize(reader));
+        ASSERT_EQUALS(msg.serialize(), msg2.serialize());
+        ASSERT_EQUALS(msg.serialize(), msg3.serialize());
+    }
+
+    void DeserializeBinaryInvalidInput() const {
+        ErrorMessage msg({fooCpp5}, "test.cpp", Severity::error, "Programming error.", "errorId", Certainty::normal);
+        BinaryWriter writer;
+        msg.serialize(writer);
+        const std::string data = writer.data();
+        {
+            // premature end of data
+            BinaryReader reader;
+            reader.setData(data.data(), data.size() - 1);
+            ErrorMessage msg2;
+            ASSERT_THROW_INTERNAL_EQUALS(msg2.deserialize(reader), INTERNAL, "Internal Error: Binary deserialization failed - premature end of data");
+        }
+        {
+            // unknown interned string
+            BinaryReader reader;
+            const std::string invalid(1, static_cast<char>(2 << 1));
+            reader.setData(invalid.data(), invalid.size());
+            ErrorMessage msg2;
+            ASSERT_THROW_INTERNAL_EQUALS(msg2.deserialize(reader), INTERNAL, "Internal Error: Binary deserialization failed - unknown string index");
+        }
+    }
+
     void substituteTemplateFormatStatic() const
     {
         {
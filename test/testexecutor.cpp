@@ -31,6 +31,7 @@
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 class DummyExecutor : public Executor
 {
@@ -39,6 +40,8 @@ public:
         : Executor(files, fileSettings, settings, suppressions, errorLogger, nullptr)
     {}
 
+    using Executor::Job;
+
     NORETURN unsigned int check() override
     {
         throw std::runtime_error("not implemented");
@@ -48,6 +51,11 @@ public:
     {
         return hasToLog(msg);
     }
+
+    std::vector<Job> getSchedule_() const
+    {
+        return getSchedule();
+    }
 };
 
 class TestExecutor : public TestFixture {
@@ -57,6 +65,8 @@ public:
 private:
     void run() override {
         TEST_CASE(hasToLogSimple);
+        TEST_CASE(scheduleFiles);
+        TEST_CASE(scheduleFileSettings);
     }
 
     void hasToLogSimple() {
@@ -83,6 +93,49 @@ private:
 
         ASSERT(executor.hasToLog_(msg));
     }
+
+    void scheduleFiles() {
+        const std::list<FileWithDetails> files{
+            FileWithDetails{"small.c", Standards::Language::C, 10},
+            FileWithDetails{"big.c", Standards::Language::C, 1000},
+            FileWithDetails{"medium1.c", Standards::Language::C, 100},
+            FileWithDetails{"medium2.c", Standards::Language::C, 100}
+        };
+        const std::list<FileSettings> fileSettings;
+        Suppressions supprs;
+        DummyExecutor executor(files, fileSettings, settingsDefault, supprs, *this);
+
+        const std::vector<DummyExecutor::Job> jobs = executor.getSchedule_();
+        ASSERT_EQUALS(4, jobs.size());
+        ASSERT_EQUALS("big.c", jobs[0].file->path());
+        ASSERT_EQUALS("medium1.c", jobs[1].file->path());
+        ASSERT_EQUALS("medium2.c", jobs[2].file->path());
+        ASSERT_EQUALS("small.c", jobs[3].file->path());
+        ASSERT(!jobs[0].fs);
+    }
+
+    void scheduleFileSettings() {
+        // the size of files from projects is not known so it is determined from the file itself
+        ScopedFile small("small.c", "int x;");
+        ScopedFile big("big.c", "int x;\nint y;\nint z;");
+        const std::list<FileWithDetails> files;
+        std::list<FileSettings> fileSettings;
+        fileSettings.emplace_back("small.c", Standards::Language::C, 0);
+        fileSettings.emplace_back("missing.c", Standards::Language::C, 0);
+        fileSettings.emplace_back("big.c", Standards::Language::C, 0);
+        Suppressions supprs;
+        DummyExecutor executor(files, fileSettings, settingsDefault, supprs, *this);
+
+        const std::vector<DummyExecutor::Job> jobs = executor.getSchedule_();
+        ASSERT_EQUALS(3, jobs.size());
+        ASSERT_EQUALS("big.c", jobs[0].fs->filename());
+        ASSERT_EQUALS(20, jobs[0].cost);
+        ASSERT_EQUALS("small.c", jobs[1].fs->filename());
+        ASSERT_EQUALS(6, jobs[1].cost);
+        ASSERT_EQUALS("missing.c", jobs[2].fs->filename());
+        ASSERT_EQUALS(0, jobs[2].cost);
+        ASSERT(!jobs[0].file);
+    }
 };
 
 REGISTER_TEST(TestExecutor)
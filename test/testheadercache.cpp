@@ -0,0 +1,211 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fixture.h"
+#include "headercache.h"
+#include "helpers.h"
+
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <simplecpp.h>
+
+class TestHeaderCache : public TestFixture {
+public:
+    TestHeaderCache() : TestFixture("TestHeaderCache") {}
+
+private:
+    void run() override {
+        TEST_CASE(read);
+        TEST_CASE(readFileIndexes);
+        TEST_CASE(readOutput);
+        TEST_CASE(readMissing);
+        TEST_CASE(modified);
+        TEST_CASE(evict);
+        TEST_CASE(tooLarge);
+    }
+
+    static std::string tokenString(const simplecpp::TokenList &tokens) {
+        std::string ret;
+        for (const simplecpp::Token *tok = tokens.cfront(); tok; tok = tok->next) {
+            ret += std::to_string(tok->location.fileIndex) + ":" + std::to_string(tok->location.line) + ":" + tok->str() + " ";
+        }
+        return ret;
+    }
+
+    void read() const {
+        const ScopedFile header("headercache_read.h", "int x; // comment\nint y;\n");
+
+        HeaderCache cache(1024 * 1024);
+
+        std::vector<std::string> files1;
+        const simplecpp::TokenList tokens1 = cache.read(header.path(), files1, nullptr);
+        ASSERT_EQUALS("0:1:int 0:1:x 0:1:; 0:1:// comment 0:2:int 0:2:y 0:2:; ", tokenString(tokens1));
+        ASSERT_EQUALS(1, files1.size());
+        ASSERT_EQUALS(header.path(), files1[0]);
+        ASSERT_EQUALS(0, cache.hits());
+        ASSERT_EQUALS(1, cache.misses());
+        ASSERT_EQUALS(1, cache.count());
+        ASSERT(cache.size() > 0);
+
+        std::vector<std::string> files2;
+        const simplecpp::TokenList tokens2 = cache.read(header.path(), files2, nullptr);
+        ASSERT_EQUALS(tokenString(tokens1), tokenString(tokens2));
+        ASSERT_EQUALS(1, files2.size());
+        ASSERT_EQUALS(1, cache.hits());
+        ASSERT_EQUALS(1, cache.misses());
+        ASSERT_EQUALS(1, cache.count());
+
+        // the cached data is not affected by modifications of the returned tokens
+        {
+            std::vector<std::string> files3;
+            simplecpp::TokenList tokens3 = cache.read(header.path(), files3, nullptr);
+            tokens3.removeComments();
+        }
+        std::vector<std::string> files4;
+        const simplecpp::TokenList tokens4 = cache.read(header.path(), files4, nullptr);
+        ASSERT_EQUALS(tokenString(tokens1), tokenString(tokens4));
+    }
+
+    void readFileIndexes() const {
+        const ScopedFile header("headercache_index.h", "#line 10 \"other.h\"\nint x;\n");
+
+        HeaderCache cache(1024 * 1024);
+
+        std::vector<std::string> files1;
+        const simplecpp::TokenList tokens1 = cache.read(header.path(), files1, nullptr);
+        ASSERT_EQUALS("0:1:# 0:1:line 0:1:10 0:1:\"other.h\" 1:10:int 1:10:x 1:10:; ", tokenString(tokens1));
+        ASSERT_EQUALS(2, files1.size());
+
+        // the file indexes refer to the filenames of the translation unit
+        std::vector<std::string> files2{"test.c", "other.h"};
+        const simplecpp::TokenList tokens2 = cache.read(header.path(), files2, nullptr);
+        ASSERT_EQUALS("2:1:# 2:1:line 2:1:10 2:1:\"other.h\" 1:10:int 1:10:x 1:10:; ", tokenString(tokens2));
+        ASSERT_EQUALS(3, files2.size());
+        ASSERT_EQUALS("test.c", files2[0]);
+        ASSERT_EQUALS("other.h", files2[1]);
+        ASSERT_EQUALS(header.path(), files2[2]);
+        ASSERT_EQUALS(1, cache.hits());
+    }
+
+    void readOutput() const {
+        const ScopedFile header("headercache_output.h", "int x; \\ \nint y;\n");
+
+        HeaderCache cache(1024 * 1024);
+
+        simplecpp::OutputList outputList1;
+        std::vector<std::string> files1;
+        (void)cache.read(header.path(), files1, &outputList1);
+        ASSERT_EQUALS(1, outputList1.size());
+
+        // the messages are reported for every read
+        simplecpp::OutputList outputList2;
+        std::vector<std::string> files2{"test.c"};
+        (void)cache.read(header.path(), files2, &outputList2);
+        ASSERT_EQUALS(1, outputList2.size());
+        ASSERT_EQUALS_ENUM(outputList1.front().type, outputList2.front().type);
+        ASSERT_EQUALS(outputList1.front().msg, outputList2.front().msg);
+        ASSERT_EQUALS(1, outputList2.front().location.fileIndex);
+        ASSERT_EQUALS(1, cache.hits());
+    }
+
+    void readMissing() const {
+        HeaderCache cache(1024 * 1024);
+
+        std::vector<std::string> files;
+        simplecpp::OutputList outputList;
+        const simplecpp::TokenList tokens = cache.read("headercache_missing.h", files, &outputList);
+        ASSERT(tokens.empty());
+        ASSERT_EQUALS(0, cache.count());
+    }
+
+    void modified() const {
+        HeaderCache cache(1024 * 1024);
+
+        std::vector<std::string> files1;
+        {
+            const ScopedFile header("headercache_modified.h", "int x;\n");
+            const simplecpp::TokenList tokens = cache.read(header.path(), files1, nullptr);
+            ASSERT_EQUALS("0:1:int 0:1:x 0:1:; ", tokenString(tokens));
+        }
+
+        std::vector<std::string> files2;
+        {
+            const ScopedFile header("headercache_modified.h", "int abc;\n");
+            const simplecpp::TokenList tokens = cache.read(header.path(), files2, nullptr);
+            ASSERT_EQUALS("0:1:int 0:1:abc 0:1:; ", tokenString(tokens));
+        }
+        ASSERT_EQUALS(0, cache.hits());
+        ASSERT_EQUALS(2, cache.misses());
+        ASSERT_EQUALS(1, cache.count());
+    }
+
+    void evict() const {
+        const ScopedFile header1("headercache_evict1.h", "int x1;\n");
+        const ScopedFile header2("headercache_evict2.h", "int x2;\n");
+        const ScopedFile header3("headercache_evict3.h", "int x3;\n");
+
+        std::size_t entrySize;
+        {
+            HeaderCache cache(1024 * 1024);
+            std::vector<std::string> files;
+            (void)cache.read(header1.path(), files, nullptr);
+            entrySize = cache.size();
+        }
+
+        // only two entries fit into the cache
+        HeaderCache cache(2 * entrySize + entrySize / 2);
+
+        std::vector<std::string> files;
+        (void)cache.read(header1.path(), files, nullptr);
+        (void)cache.read(header2.path(), files, nullptr);
+        (void)cache.read(header1.path(), files, nullptr);
+        ASSERT_EQUALS(2, cache.count());
+        ASSERT_EQUALS(1, cache.hits());
+
+        // the least recently used entry is evicted
+        (void)cache.read(header3.path(), files, nullptr);
+        ASSERT_EQUALS(2, cache.count());
+        ASSERT(cache.size() <= cache.maxSize());
+        (void)cache.read(header1.path(), files, nullptr);
+        ASSERT_EQUALS(2, cache.hits());
+        (void)cache.read(header2.path(), files, nullptr);
+        ASSERT_EQUALS(2, cache.hits());
+        ASSERT_EQUALS(4, cache.misses());
+
+        cache.clear();
+        ASSERT_EQUALS(0, cache.count());
+        ASSERT_EQUALS(0, cache.size());
+    }
+
+    void tooLarge() const {
+        const ScopedFile header("headercache_large.h", "int x;\n");
+
+        HeaderCache cache(1);
+
+        std::vector<std::string> files;
+        const simplecpp::TokenList tokens = cache.read(header.path(), files, nullptr);
+        ASSERT_EQUALS("0:1:int 0:1:x 0:1:; ", tokenString(tokens));
+        ASSERT_EQUALS(0, cache.count());
+        ASSERT_EQUALS(0, cache.size());
+    }
+};
+
+REGISTER_TEST(TestHeaderCache)
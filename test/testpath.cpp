@@ -56,6 +56,7 @@ private:
         TEST_CASE(simplifyPath);
         TEST_CASE(getAbsolutePath);
         TEST_CASE(exists);
+        TEST_CASE(fileSize);
         TEST_CASE(fromNativeSeparators);
         TEST_CASE(isRelative);
     }
@@ -608,6 +609,16 @@ private:
         ASSERT_EQUALS(false, b);
     }
 
+    void fileSize() const {
+        ScopedFile file("testpath.txt", "int x;", "testpath");
+        ScopedFile file2("testpath2.txt", "");
+
+        ASSERT_EQUALS(6, Path::fileSize("testpath/testpath.txt"));
+        ASSERT_EQUALS(0, Path::fileSize("testpath2.txt"));
+        ASSERT_EQUALS(0, Path::fileSize("testpath"));
+        ASSERT_EQUALS(0, Path::fileSize("testpath3.txt"));
+    }
+
     void fromNativeSeparators() const {
         ASSERT_EQUALS("lib/file.c", Path::fromNativeSeparators("lib/file.c"));
         ASSERT_EQUALS("lib//file.c", Path::fromNativeSeparators("lib//file.c"));
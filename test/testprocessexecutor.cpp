@@ -67,6 +67,7 @@ private:
         Settings::ShowTime showtime = Settings::ShowTime::NONE;
         const char* plistOutput = nullptr;
         std::vector<std::string> filesList;
+        unsigned int processMaxFiles = 1;
     };
 
     /**
@@ -100,6 +101,7 @@ private:
         s.jobs = jobs;
         s.showtime = opt.showtime;
         s.quiet = opt.quiet;
+        s.processMaxFiles = opt.processMaxFiles;
         if (opt.plistOutput)
             s.plistOutput = opt.plistOutput;
         s.templateFormat = "{callstack}: ({severity}) {inconclusive:inconclusive: }{message}";
@@ -144,6 +146,9 @@ private:
         TEST_CASE(showtime_file_total);
         TEST_CASE(suppress_error_library);
         TEST_CASE(unique_errors);
+        TEST_CASE(reuse_processes);
+        TEST_CASE(reuse_processes_limited);
+        TEST_CASE(reuse_processes_showtime);
 #endif // HAS_THREADING_MODEL_FORK
     }
 
@@ -302,6 +307,42 @@ private:
         ASSERT_EQUALS("[" + inc_h.name() + ":3:12]: (error) Null pointer dereference: (int*)0 [nullPointer]\n", errout_str());
     }
 
+    void reuse_processes() {
+        const int num_files = 20;
+        check(2, num_files, num_files,
+              "void f()\n"
+              "{\n"
+              "  (void)(*((int*)0));\n"
+              "}", dinit(CheckOptions, $.processMaxFiles = 0));
+        const std::string errout = errout_str();
+        ASSERT_EQUALS(num_files, cppcheck::count_all_of(errout, "(error) Null pointer dereference: (int*)0"));
+        for (int i = 1; i <= num_files; ++i)
+            ASSERT(errout.find("[" + fprefix() + "_" + std::to_string(i) + ".c:3:12]") != std::string::npos);
+    }
+
+    void reuse_processes_limited() {
+        const int num_files = 20;
+        check(3, num_files, num_files,
+              "void f()\n"
+              "{\n"
+              "  (void)(*((int*)0));\n"
+              "}", dinit(CheckOptions, $.processMaxFiles = 3));
+        ASSERT_EQUALS(num_files, cppcheck::count_all_of(errout_str(), "(error) Null pointer dereference: (int*)0"));
+    }
+
+    void reuse_processes_showtime() {
+        SUPPRESS;
+        check(2, 20, 20,
+              "void f()\n"
+              "{\n"
+              "  (void)(*((int*)0));\n"
+              "}", dinit(CheckOptions,
+                         $.showtime = Settings::ShowTime::SUMMARY,
+                         $.processMaxFiles = 0));
+        // we are not interested in the results - so just consume them
+        ignore_errout();
+    }
+
     // TODO: test whole program analysis
 #endif // HAS_THREADING_MODEL_FORK
 };
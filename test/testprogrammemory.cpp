@@ -24,7 +24,9 @@
 #include "utils.h"
 #include "vfvalue.h"
 
+#include <iterator>
 #include <stdexcept>
+#include <vector>
 
 class TestProgramMemory : public TestFixture {
 public:
@@ -36,6 +38,7 @@ private:
         TEST_CASE(hasValue);
         TEST_CASE(getValue);
         TEST_CASE(at);
+        TEST_CASE(exprIdMap);
     }
 
     void copyOnWrite() const {
@@ -101,6 +104,51 @@ private:
         ASSERT_THROW_EQUALS(pm.at(123), std::out_of_range, "ProgramMemory::at");
         ASSERT_THROW_EQUALS(utils::as_const(pm).at(123), std::out_of_range, "ProgramMemory::at");
     }
+
+    void exprIdMap() const {
+        SimpleTokenList tokenlist("1+1;");
+        Token* tok = tokenlist.front();
+
+        ExprIdMap m1;
+        ASSERT(m1.begin() == m1.end());
+        const std::vector<nonneg int> ids{5, 1000000, 33, 1, 70000, 32};
+        for (const nonneg int id : ids) {
+            tok->exprId(id);
+            m1[tok] = ValueFlow::Value{id};
+        }
+        ASSERT_EQUALS(6U, m1.size());
+
+        // entries are iterated in the order of the expression ids
+        std::vector<nonneg int> order;
+        for (const ExprIdMap::value_type& p : m1) {
+            ASSERT_EQUALS(p.first.getExpressionId(), p.second.intvalue);
+            order.push_back(p.first.getExpressionId());
+        }
+        ASSERT(order == std::vector<nonneg int>({1, 5, 32, 33, 70000, 1000000}));
+
+        // modifying a copy does not modify the original
+        ExprIdMap m2 = m1;
+        ASSERT(m2.sameData(m1));
+        m2.findMutable(33)->second.intvalue = 0;
+        m2.erase_if([](const ExprIdToken& e) {
+            return e.getExpressionId() >= 70000;
+        });
+        ASSERT(!m2.sameData(m1));
+        ASSERT_EQUALS(4U, m2.size());
+        ASSERT(!m2.find(1000000));
+        ASSERT_EQUALS(0, m2.find(33)->second.intvalue);
+        ASSERT_EQUALS(6U, m1.size());
+        ASSERT_EQUALS(33, m1.find(33)->second.intvalue);
+        ASSERT_EQUALS(1000000, m1.find(1000000)->second.intvalue);
+        ASSERT(!m1.find(34));
+
+        m2.erase_if([](const ExprIdToken&) {
+            return true;
+        });
+        ASSERT(m2.empty());
+        ASSERT(m2.begin() == m2.end());
+        ASSERT_EQUALS(6, std::distance(m1.begin(), m1.end()));
+    }
 };
 
 REGISTER_TEST(TestProgramMemory)
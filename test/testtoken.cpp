@@ -25,6 +25,7 @@
 #include "vfvalue.h"
 
 #include <algorithm>
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
@@ -90,6 +91,7 @@ private:
         TEST_CASE(matchOr);
         TEST_CASE(matchOp);
         TEST_CASE(matchConstOp);
+        TEST_CASE(matchCompiled);
 
         TEST_CASE(isArithmeticalOp);
         TEST_CASE(isOp);
@@ -121,6 +123,11 @@ private:
         TEST_CASE(expressionString);
 
         TEST_CASE(hasKnownIntValue);
+        TEST_CASE(valueChanges);
+        TEST_CASE(values);
+        TEST_CASE(sharedErrorPath);
+        TEST_CASE(arena);
+        TEST_CASE(strings);
 
         TEST_CASE(update_property_info);
         TEST_CASE(update_property_info_evariable);
@@ -871,6 +878,46 @@ private:
     }
 
 
+#define assertMatchCompiled(...) assertMatchCompiled_(__FILE__, __LINE__, __VA_ARGS__)
+    template<class Pattern>
+    void assertMatchCompiled_(const char* file, int line, const Token* tokens, const char pattern[], Pattern compiled) const {
+        for (const Token* tok = tokens;; tok = tok->next()) {
+            ASSERT_EQUALS_LOC_MSG(Token::Match(tok, pattern, 1), Token::Match(tok, compiled, 1), pattern, file, line);
+            if (!tok)
+                break;
+        }
+    }
+
+    void matchCompiled() {
+        SimpleTokenizer var(*this);
+        ASSERT(var.tokenize("int a ; int b [ 2 ] ; void f ( ) { if ( a == 1 || b [ 0 ] | 2 ) { a = 'c' ; } "
+                            "else { f ( \"s\" , true , 3 + 4 , ~ a ) ; } a += 1 ; a % 2 ; x :: y ( ) ; }"));
+        const Token* tokens = var.tokens();
+
+        // the compiled patterns match the same tokens as the runtime interpretation
+        assertMatchCompiled(tokens, "%name% (", MATCH_PATTERN("%name% ("));
+        assertMatchCompiled(tokens, "if|while|for (", MATCH_PATTERN("if|while|for ("));
+        assertMatchCompiled(tokens, "{|}|namespace|class|struct|union", MATCH_PATTERN("{|}|namespace|class|struct|union"));
+        assertMatchCompiled(tokens, "[({]", MATCH_PATTERN("[({]"));
+        assertMatchCompiled(tokens, "[})]]", MATCH_PATTERN("[})]]"));
+        assertMatchCompiled(tokens, "[]]]", MATCH_PATTERN("[]]]"));
+        assertMatchCompiled(tokens, "&&|?|%oror%", MATCH_PATTERN("&&|?|%oror%"));
+        assertMatchCompiled(tokens, "%cop%|[|.", MATCH_PATTERN("%cop%|[|."));
+        assertMatchCompiled(tokens, "%bool%|%num%|%str%|%char%|nullptr", MATCH_PATTERN("%bool%|%num%|%str%|%char%|nullptr"));
+        assertMatchCompiled(tokens, "%assign%", MATCH_PATTERN("%assign%"));
+        assertMatchCompiled(tokens, "%comp%|%or%", MATCH_PATTERN("%comp%|%or%"));
+        assertMatchCompiled(tokens, "%op% %any%", MATCH_PATTERN("%op% %any%"));
+        assertMatchCompiled(tokens, "%type% %varid%", MATCH_PATTERN("%type% %varid%"));
+        assertMatchCompiled(tokens, "[;{}] %var% =|+=", MATCH_PATTERN("[;{}] %var% =|+="));
+        assertMatchCompiled(tokens, "::| %name% ::", MATCH_PATTERN("::| %name% ::"));
+        assertMatchCompiled(tokens, ") !!{", MATCH_PATTERN(") !!{"));
+        assertMatchCompiled(tokens, "} !!else", MATCH_PATTERN("} !!else"));
+        assertMatchCompiled(tokens, "%|%= %num%", MATCH_PATTERN("%|%= %num%"));
+        assertMatchCompiled(tokens, "  int   %name%  [|; ", MATCH_PATTERN("  int   %name%  [|; "));
+
+        ASSERT_THROW_INTERNAL_EQUALS((void)Token::Match(tokens, MATCH_PATTERN("%type% %varid%"), 0), INTERNAL, "Internal error. Token::Match called with varid 0.");
+    }
+
     void isArithmeticalOp() const {
         for (auto test_op = arithmeticalOps.cbegin(); test_op != arithmeticalOps.cend(); ++test_op) {
             auto tokensFrontBack = std::make_shared<TokensFrontBack>();
@@ -1266,6 +1313,184 @@ private:
         ASSERT_EQUALS(false, token.hasKnownIntValue());
     }
 
+    void valueChanges() const {
+        ValueFlow::Value v1(1);
+        v1.setKnown();
+        ValueFlow::Value v2(2);
+
+        auto tokensFrontBack = std::make_shared<TokensFrontBack>();
+        Token token(list, tokensFrontBack);
+        ASSERT_EQUALS(true, token.addValue(v1));
+        ASSERT_EQUALS(1, tokensFrontBack->valueChanges);
+
+        // replacing the known value with the same value is no change
+        ASSERT_EQUALS(true, token.addValue(v1));
+        ASSERT_EQUALS(1, tokensFrontBack->valueChanges);
+
+        // a possible value is not added when there is a known value
+        ASSERT_EQUALS(false, token.addValue(v2));
+        ASSERT_EQUALS(1, tokensFrontBack->valueChanges);
+
+        token.removeValues(std::mem_fn(&ValueFlow::Value::isKnown));
+        ASSERT_EQUALS(2, tokensFrontBack->valueChanges);
+        ASSERT_EQUALS(true, token.addValue(v2));
+        ASSERT_EQUALS(3, tokensFrontBack->valueChanges);
+        ASSERT_EQUALS(3, tokensFrontBack->scopeValueChanges[nullptr]);
+
+        token.removeValues(std::mem_fn(&ValueFlow::Value::isKnown));
+        ASSERT_EQUALS(3, tokensFrontBack->valueChanges);
+    }
+
+    void values() const {
+        ValueFlow::Value v1(1);
+        ValueFlow::Value v2(2);
+        ValueFlow::Value v3(3);
+        v3.setKnown();
+        v3.valueType = ValueFlow::Value::ValueType::BUFFER_SIZE;
+
+        auto tokensFrontBack = std::make_shared<TokensFrontBack>();
+        Token token(list, std::move(tokensFrontBack));
+        ASSERT_EQUALS(true, token.addValue(v1));
+        ASSERT_EQUALS(true, token.addValue(v2));
+        ASSERT_EQUALS(false, token.addValue(v2));
+        ASSERT_EQUALS(true, token.addValue(v3));
+        ASSERT_EQUALS(3U, token.values().size());
+        ASSERT_EQUALS(1, token.values()[0].intvalue);
+        ASSERT_EQUALS(2, token.values()[1].intvalue);
+        ASSERT_EQUALS(3, token.values()[2].intvalue);
+
+        // a known int value is put first
+        v1.setKnown();
+        ASSERT_EQUALS(true, token.addValue(v1));
+        ASSERT_EQUALS(2U, token.values().size());
+        ASSERT_EQUALS(true, token.hasKnownIntValue());
+        ASSERT_EQUALS(1, token.getKnownIntValue());
+
+        token.removeValues(std::mem_fn(&ValueFlow::Value::isIntValue));
+        ASSERT_EQUALS(1U, token.values().size());
+        ASSERT_EQUALS(3, token.values()[0].intvalue);
+
+        // the debug path and subexpressions are shared by copies until one of them is modified
+        ValueFlow::Value v4(4);
+        ASSERT_EQUALS(true, v4.debugPath().empty());
+        v4.addSubexpression("x");
+        ValueFlow::Value v5(v4);
+        v5.addSubexpression("y");
+        v5.addDebugPath({nullptr, "debug"});
+        ASSERT_EQUALS(1U, v4.subexpressions().size());
+        ASSERT_EQUALS(true, v4.debugPath().empty());
+        ASSERT_EQUALS(2U, v5.subexpressions().size());
+        ASSERT_EQUALS(1U, v5.debugPath().size());
+        v5.clearSubexpressions();
+        ASSERT_EQUALS(true, v5.subexpressions().empty());
+        ASSERT_EQUALS(1U, v4.subexpressions().size());
+    }
+
+    void sharedErrorPath() const {
+        auto tokensFrontBack = std::make_shared<TokensFrontBack>();
+        Token tok1(list, tokensFrontBack);
+        Token tok2(list, tokensFrontBack);
+
+        ValueFlow::SharedErrorPath p1;
+        ASSERT_EQUALS(true, p1.empty());
+        p1.emplace_back(&tok1, "a");
+        p1.emplace_back(&tok2, "b");
+        ASSERT_EQUALS(2U, p1.size());
+        ASSERT(&tok2 == p1.backToken());
+        ASSERT_EQUALS("b", p1.backInfo());
+
+        // copies share the items, appending to a copy does not change the original
+        ValueFlow::SharedErrorPath p2 = p1;
+        p2.emplace_back(&tok1, "c");
+        p2.emplace_front(&tok2, "d");
+        ASSERT_EQUALS(2U, p1.size());
+        ASSERT_EQUALS(4U, p2.size());
+
+        const ErrorPath l2 = p2.toList();
+        const ErrorPath expected{{&tok2, "d"}, {&tok1, "a"}, {&tok2, "b"}, {&tok1, "c"}};
+        ASSERT(expected == l2);
+
+        ValueFlow::SharedErrorPath p3(l2);
+        p3.prepend(ErrorPath{{&tok1, "e"}});
+        p3.append(p1);
+        ASSERT_EQUALS(7U, p3.size());
+        ASSERT_EQUALS("e", p3.toList().front().second);
+        ASSERT_EQUALS("b", p3.backInfo());
+
+        std::string infos;
+        p3.forEach([&](const Token* /*tok*/, const std::string& info) {
+            infos += info;
+        });
+        ASSERT_EQUALS("edabcab", infos);
+
+        p3.clear();
+        ASSERT_EQUALS(true, p3.empty());
+        ASSERT_EQUALS(0U, p3.size());
+    }
+
+    void arena() const {
+        TokenArena arena;
+        void* const p1 = arena.allocate(24);
+        void* const p2 = arena.allocate(24);
+        ASSERT(p1 != p2);
+        ASSERT_EQUALS(64 * 1024, arena.getReservedBytes());
+
+        // released memory is reused for the same size only
+        arena.deallocate(p1, 24);
+        ASSERT(p1 != arena.allocate(100));
+        ASSERT(p1 == arena.allocate(24));
+
+        // tokens created with new and in the arena can be mixed
+        auto tokensFrontBack = std::make_shared<TokensFrontBack>();
+        auto *token = new Token(list, tokensFrontBack);
+        token->str("1");
+        (void)token->insertToken("2");
+        (void)token->insertToken("3");
+        ASSERT(tokensFrontBack->arena.getReservedBytes() > 0);
+        token->deleteThis();
+        ASSERT_EQUALS("3", token->str());
+        ASSERT_EQUALS("2", token->strAt(1));
+        token->deleteNext();
+        ASSERT(token->next() == nullptr);
+        TokenList::deleteTokens(token);
+    }
+
+    void strings() const {
+        TokenStrings strings;
+        ASSERT_EQUALS(0U, TokenStrings::getEmpty()->second);
+        ASSERT(strings.intern("") == TokenStrings::getEmpty());
+
+        // keywords and punctuators have fixed entries shared by all lists
+        ASSERT(strings.intern("while") == TokenStrings::getFixed("while"));
+        ASSERT(strings.intern("<<=") == TokenStrings::getFixed("<<="));
+        ASSERT(TokenStrings::getFixed("x") == nullptr);
+        ASSERT(TokenStrings::getFixed("\"while\"") == nullptr);
+        ASSERT_EQUALS(0U, strings.size());
+
+        // other strings are interned once per list
+        const TokenStrings::Entry* const x = strings.intern("x");
+        ASSERT_EQUALS("x", x->first);
+        ASSERT(x == strings.intern("x"));
+        ASSERT(x->second != strings.intern("y")->second);
+        ASSERT_EQUALS(2U, strings.size());
+
+        // tokens compare by string also when they are in different lists
+        auto tokensFrontBack1 = std::make_shared<TokensFrontBack>();
+        auto tokensFrontBack2 = std::make_shared<TokensFrontBack>();
+        Token tok1(list, std::move(tokensFrontBack1));
+        Token tok2(list, std::move(tokensFrontBack2));
+        ASSERT_EQUALS(0U, tok1.strId());
+        ASSERT(Token::sameStr(&tok1, &tok2));
+        tok1.str("x");
+        tok2.str("x");
+        ASSERT(Token::sameStr(&tok1, &tok2));
+        tok2.str("y");
+        ASSERT(!Token::sameStr(&tok1, &tok2));
+        tok1.str("return");
+        tok2.str("return");
+        ASSERT_EQUALS(tok1.strId(), tok2.strId());
+    }
+
 #define assert_tok(...) _assert_tok(__FILE__, __LINE__, __VA_ARGS__)
     void _assert_tok(const char* file, int line, const Token* tok, Token::Type t, bool l = false, bool std = false, bool ctrl = false) const
     {
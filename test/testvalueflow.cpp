@@ -387,7 +387,7 @@ private:
 
             std::ostringstream ostr;
             for (const ValueFlow::Value &v : tok->values()) {
-                for (const ErrorPathItem &ep : v.errorPath) {
+                for (const ErrorPathItem &ep : v.errorPath.toList()) {
                     const Token *eptok = ep.first;
                     const std::string &msg = ep.second;
                     ostr << eptok->linenr() << ',' << msg << '\n';
@@ -502,18 +502,18 @@ private:
     }
 
 #define tokenValues(...) tokenValues_(__FILE__, __LINE__, __VA_ARGS__)
-    std::list<ValueFlow::Value> tokenValues_(const char* file, int line, const char code[], const char tokstr[], const Settings *s = nullptr, bool cpp = true) {
+    std::vector<ValueFlow::Value> tokenValues_(const char* file, int line, const char code[], const char tokstr[], const Settings *s = nullptr, bool cpp = true) {
         SimpleTokenizer tokenizer(s ? *s : settings, *this, cpp);
         ASSERT_LOC(tokenizer.tokenize(code), file, line);
         const Token *tok = Token::findmatch(tokenizer.tokens(), tokstr);
-        return tok ? tok->values() : std::list<ValueFlow::Value>();
+        return tok ? tok->values() : std::vector<ValueFlow::Value>();
     }
 
-    std::list<ValueFlow::Value> tokenValues_(const char* file, int line, const char code[], const char tokstr[], ValueFlow::Value::ValueType vt) {
-        std::list<ValueFlow::Value> values = tokenValues_(file, line, code, tokstr);
-        values.remove_if([&](const ValueFlow::Value& v) {
+    std::vector<ValueFlow::Value> tokenValues_(const char* file, int line, const char code[], const char tokstr[], ValueFlow::Value::ValueType vt) {
+        std::vector<ValueFlow::Value> values = tokenValues_(file, line, code, tokstr);
+        values.erase(std::remove_if(values.begin(), values.end(), [&](const ValueFlow::Value& v) {
             return v.valueType != vt;
-        });
+        }), values.end());
         return values;
     }
 
@@ -538,7 +538,7 @@ private:
 
 #define valueOfTok(...) valueOfTok_(__FILE__, __LINE__, __VA_ARGS__)
     ValueFlow::Value valueOfTok_(const char* file, int line, const char code[], const char tokstr[], const Settings *s = nullptr, bool cpp = true) {
-        std::list<ValueFlow::Value> values = removeImpossible(tokenValues_(file, line, code, tokstr, s, cpp));
+        std::vector<ValueFlow::Value> values = removeImpossible(tokenValues_(file, line, code, tokstr, s, cpp));
         return values.size() == 1U && !values.front().isTokValue() ? values.front() : ValueFlow::Value();
     }
 
@@ -549,23 +549,23 @@ private:
                               const char tokstr[],
                               int value)
     {
-        std::list<ValueFlow::Value> values = removeImpossible(tokenValues_(file, line, code, tokstr));
+        std::vector<ValueFlow::Value> values = removeImpossible(tokenValues_(file, line, code, tokstr));
         return std::any_of(values.begin(), values.end(), [&](const ValueFlow::Value& v) {
             return v.isKnown() && v.isIntValue() && v.intvalue == value;
         });
     }
 
-    static std::list<ValueFlow::Value> removeSymbolicTok(std::list<ValueFlow::Value> values)
+    static std::vector<ValueFlow::Value> removeSymbolicTok(std::vector<ValueFlow::Value> values)
     {
-        values.remove_if([](const ValueFlow::Value& v) {
+        values.erase(std::remove_if(values.begin(), values.end(), [](const ValueFlow::Value& v) {
             return v.isSymbolicValue() || v.isTokValue();
-        });
+        }), values.end());
         return values;
     }
 
-    static std::list<ValueFlow::Value> removeImpossible(std::list<ValueFlow::Value> values)
+    static std::vector<ValueFlow::Value> removeImpossible(std::vector<ValueFlow::Value> values)
     {
-        values.remove_if(std::mem_fn(&ValueFlow::Value::isImpossible));
+        values.erase(std::remove_if(values.begin(), values.end(), std::mem_fn(&ValueFlow::Value::isImpossible)), values.end());
         return values;
     }
 
@@ -753,7 +753,7 @@ private:
 
     void valueFlowPointerAlias() {
         const char *code;
-        std::list<ValueFlow::Value> values;
+        std::vector<ValueFlow::Value> values;
 
         code  = "const char * f() {\n"
                 "    static const char *x;\n"
@@ -776,11 +776,11 @@ private:
                 "  x = &x[1];\n"
                 "}";
         values = tokenValues(code, "&");
-        values.remove_if(&isNotTokValue);
+        values.erase(std::remove_if(values.begin(), values.end(), &isNotTokValue), values.end());
         ASSERT_EQUALS(true, values.empty());
 
         values = tokenValues(code, "x [");
-        values.remove_if(&isNotTokValue);
+        values.erase(std::remove_if(values.begin(), values.end(), &isNotTokValue), values.end());
         ASSERT_EQUALS(true, values.empty());
     }
 
@@ -1187,7 +1187,7 @@ private:
                 "    if (x==2) {}\n"
                 "    if (x==4) {}\n"
                 "}";
-        std::list<ValueFlow::Value> values = tokenValues(code,"*");
+        std::vector<ValueFlow::Value> values = tokenValues(code,"*");
         ASSERT_EQUALS(2U, values.size());
         ASSERT_EQUALS(4, values.front().intvalue);
         ASSERT_EQUALS(16, values.back().intvalue);
@@ -1399,7 +1399,7 @@ private:
 
     void valueFlowSizeof() {
         const char *code;
-        std::list<ValueFlow::Value> values;
+        std::vector<ValueFlow::Value> values;
 
         // array size
         code  = "void f() {\n"
@@ -1832,7 +1832,7 @@ private:
     void valueFlowComma()
     {
         const char* code;
-        std::list<ValueFlow::Value> values;
+        std::vector<ValueFlow::Value> values;
 
         code = "void f(int i) {\n"
                "    int x = (i, 4);\n"
@@ -2302,8 +2302,7 @@ private:
                 "}");
         ASSERT_EQUALS_WITHOUT_LINENUMBERS(
             "[test.cpp:3]: (debug) valueFlowConditionExpressions bailout: Skipping function due to incomplete variable a\n"
-            "[test.cpp:4]: (debug) valueflow.cpp:1260:(valueFlow) bailout: variable 'x', condition is defined in macro\n"
-            "[test.cpp:4]: (debug) valueflow.cpp:1260:(valueFlow) bailout: variable 'x', condition is defined in macro\n", // duplicate
+            "[test.cpp:4]: (debug) valueflow.cpp:1260:(valueFlow) bailout: variable 'x', condition is defined in macro\n",
             errout_str());
 
         bailout("#define FREE(obj) ((obj) ? (free((char *) (obj)), (obj) = 0) : 0)\n" // #8349
@@ -2328,8 +2327,7 @@ private:
                 "}");
         ASSERT_EQUALS_WITHOUT_LINENUMBERS(
             "[test.cpp:3]: (debug) valueFlowConditionExpressions bailout: Skipping function due to incomplete variable a\n"
-            "[test.cpp:2]: (debug) valueflow.cpp::(valueFlow) bailout: valueFlowAfterCondition: bailing in conditional block\n"
-            "[test.cpp:2]: (debug) valueflow.cpp::(valueFlow) bailout: valueFlowAfterCondition: bailing in conditional block\n", // duplicate
+            "[test.cpp:2]: (debug) valueflow.cpp::(valueFlow) bailout: valueFlowAfterCondition: bailing in conditional block\n",
             errout_str());
 
         // #5721 - FP
@@ -2344,8 +2342,7 @@ private:
                 "    if (abc) {}\n"
                 "}");
         ASSERT_EQUALS_WITHOUT_LINENUMBERS(
-            "[test.cpp:3]: (debug) valueflow.cpp:6730:(valueFlow) bailout: valueFlowAfterCondition: bailing in conditional block\n"
-            "[test.cpp:3]: (debug) valueflow.cpp:6730:(valueFlow) bailout: valueFlowAfterCondition: bailing in conditional block\n", // duplicate
+            "[test.cpp:3]: (debug) valueflow.cpp:6730:(valueFlow) bailout: valueFlowAfterCondition: bailing in conditional block\n",
             errout_str());
     }
 
@@ -4568,7 +4565,7 @@ private:
 
     void valueFlowFwdAnalysis() {
         const char *code;
-        std::list<ValueFlow::Value> values;
+        std::vector<ValueFlow::Value> values;
 
         code = "void f() {\n"
                "  struct Foo foo;\n"
@@ -4652,9 +4649,9 @@ private:
                "    for (s.x = 0; s.x < 127; s.x++) {}\n"
                "}";
         values = removeImpossible(tokenValues(code, "<"));
-        values.remove_if([&](const ValueFlow::Value& v) {
+        values.erase(std::remove_if(values.begin(), values.end(), [&](const ValueFlow::Value& v) {
             return !v.isKnown();
-        });
+        }), values.end());
         ASSERT_EQUALS(true, values.empty());
     }
 
@@ -4953,7 +4950,7 @@ private:
                "    for (x = 0; x < 10; x++)\n"
                "        x;\n"
                "}";
-        std::list<ValueFlow::Value> values = tokenValues(code, "x <");
+        std::vector<ValueFlow::Value> values = tokenValues(code, "x <");
         ASSERT(std::none_of(values.cbegin(), values.cend(), std::mem_fn(&ValueFlow::Value::isUninitValue)));
 
         // #9637
@@ -6035,7 +6032,7 @@ private:
 
     void valueFlowUninit() {
         const char* code;
-        std::list<ValueFlow::Value> values;
+        std::vector<ValueFlow::Value> values;
 
         code = "void f() {\n"
                "    int x;\n"
@@ -6116,7 +6113,7 @@ private:
                "  return((n=42) && *n == 'A');\n"
                "}";
         values = tokenValues(code, "n ==");
-        values.remove_if(&isNotUninitValue);
+        values.erase(std::remove_if(values.begin(), values.end(), &isNotUninitValue), values.end());
         ASSERT_EQUALS(true, values.empty());
 
         // #8233
@@ -6141,7 +6138,7 @@ private:
                "    a = x + 1;\n"
                "}\n";
         values = tokenValues(code, "x +");
-        values.remove_if(&isNotUninitValue);
+        values.erase(std::remove_if(values.begin(), values.end(), &isNotUninitValue), values.end());
         ASSERT_EQUALS(true, values.empty());
 
         // #8494 - overloaded operator &
@@ -6450,7 +6447,7 @@ private:
 
     void valueFlowConditionExpressions() {
         const char* code;
-        std::list<ValueFlow::Value> values;
+        std::vector<ValueFlow::Value> values;
 
         // opposite condition
         code = "void f(int i, int j) {\n"
@@ -6692,13 +6689,13 @@ private:
         ASSERT_EQUALS(true, testKnownValueOfTok(code, "=", 0));
     }
 
-    static std::string isPossibleContainerSizeValue(std::list<ValueFlow::Value> values,
+    static std::string isPossibleContainerSizeValue(std::vector<ValueFlow::Value> values,
                                                     MathLib::bigint i,
                                                     bool unique = true) {
-        values.remove_if(std::mem_fn(&ValueFlow::Value::isSymbolicValue));
-        values.remove_if(std::mem_fn(&ValueFlow::Value::isTokValue));
+        values.erase(std::remove_if(values.begin(), values.end(), std::mem_fn(&ValueFlow::Value::isSymbolicValue)), values.end());
+        values.erase(std::remove_if(values.begin(), values.end(), std::mem_fn(&ValueFlow::Value::isTokValue)), values.end());
         if (!unique)
-            values.remove_if(&isNotPossible);
+            values.erase(std::remove_if(values.begin(), values.end(), &isNotPossible), values.end());
         if (values.size() != 1)
             return "values.size():" + std::to_string(values.size());
         if (!values.front().isContainerSizeValue())
@@ -6710,13 +6707,13 @@ private:
         return "";
     }
 
-    static std::string isImpossibleContainerSizeValue(std::list<ValueFlow::Value> values,
+    static std::string isImpossibleContainerSizeValue(std::vector<ValueFlow::Value> values,
                                                       MathLib::bigint i,
                                                       bool unique = true) {
-        values.remove_if(std::mem_fn(&ValueFlow::Value::isSymbolicValue));
-        values.remove_if(std::mem_fn(&ValueFlow::Value::isTokValue));
+        values.erase(std::remove_if(values.begin(), values.end(), std::mem_fn(&ValueFlow::Value::isSymbolicValue)), values.end());
+        values.erase(std::remove_if(values.begin(), values.end(), std::mem_fn(&ValueFlow::Value::isTokValue)), values.end());
         if (!unique)
-            values.remove_if(&isNotImpossible);
+            values.erase(std::remove_if(values.begin(), values.end(), &isNotImpossible), values.end());
         if (values.size() != 1)
             return "values.size():" + std::to_string(values.size());
         if (!values.front().isContainerSizeValue())
@@ -6728,13 +6725,13 @@ private:
         return "";
     }
 
-    static std::string isInconclusiveContainerSizeValue(std::list<ValueFlow::Value> values,
+    static std::string isInconclusiveContainerSizeValue(std::vector<ValueFlow::Value> values,
                                                         MathLib::bigint i,
                                                         bool unique = true) {
-        values.remove_if(std::mem_fn(&ValueFlow::Value::isSymbolicValue));
-        values.remove_if(std::mem_fn(&ValueFlow::Value::isTokValue));
+        values.erase(std::remove_if(values.begin(), values.end(), std::mem_fn(&ValueFlow::Value::isSymbolicValue)), values.end());
+        values.erase(std::remove_if(values.begin(), values.end(), std::mem_fn(&ValueFlow::Value::isTokValue)), values.end());
         if (!unique)
-            values.remove_if(&isNotInconclusive);
+            values.erase(std::remove_if(values.begin(), values.end(), &isNotInconclusive), values.end());
         if (values.size() != 1)
             return "values.size():" + std::to_string(values.size());
         if (!values.front().isContainerSizeValue())
@@ -6746,11 +6743,11 @@ private:
         return "";
     }
 
-    static std::string isKnownContainerSizeValue(std::list<ValueFlow::Value> values, MathLib::bigint i, bool unique = true) {
-        values.remove_if(std::mem_fn(&ValueFlow::Value::isSymbolicValue));
-        values.remove_if(std::mem_fn(&ValueFlow::Value::isTokValue));
+    static std::string isKnownContainerSizeValue(std::vector<ValueFlow::Value> values, MathLib::bigint i, bool unique = true) {
+        values.erase(std::remove_if(values.begin(), values.end(), std::mem_fn(&ValueFlow::Value::isSymbolicValue)), values.end());
+        values.erase(std::remove_if(values.begin(), values.end(), std::mem_fn(&ValueFlow::Value::isTokValue)), values.end());
         if (!unique)
-            values.remove_if(&isNotKnown);
+            values.erase(std::remove_if(values.begin(), values.end(), &isNotKnown), values.end());
         if (values.size() != 1)
             return "values.size():" + std::to_string(values.size());
         if (!values.front().isContainerSizeValue())
@@ -7800,7 +7797,7 @@ private:
 
     void valueFlowSafeFunctionParameterValues() {
         const char *code;
-        std::list<ValueFlow::Value> values;
+        std::vector<ValueFlow::Value> values;
         /*const*/ Settings s = settingsBuilder().library("std.cfg").build();
         s.safeChecks.classes = s.safeChecks.externalFunctions = s.safeChecks.internalFunctions = true;
 
@@ -7840,9 +7837,9 @@ private:
                "  return x + 0;\n"
                "}";
         values = removeSymbolicTok(tokenValues(code, "+", &s));
-        values.remove_if([](const ValueFlow::Value& v) {
+        values.erase(std::remove_if(values.begin(), values.end(), [](const ValueFlow::Value& v) {
             return v.isImpossible();
-        });
+        }), values.end());
         ASSERT_EQUALS(2, values.size());
         ASSERT_EQUALS(0, values.front().intvalue);
         ASSERT_EQUALS(100, values.back().intvalue);
@@ -7859,7 +7856,7 @@ private:
 
     void valueFlowUnknownFunctionReturnRand() {
         const char *code;
-        std::list<ValueFlow::Value> values;
+        std::vector<ValueFlow::Value> values;
         /*const*/ Settings s = settingsBuilder().library("std.cfg").build();
         s.checkUnknownFunctionReturn.insert("rand");
 
@@ -8863,7 +8860,7 @@ private:
 
     void valueFlowIncDec() {
         const char *code;
-        std::list<ValueFlow::Value> values;
+        std::vector<ValueFlow::Value> values;
 
         // #11591
         code = "int f() {\n"
@@ -0,0 +1,122 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Compare the runtime interpretation of Token::Match() patterns with the compiled patterns
+
+#include "settings.h"
+#include "standards.h"
+#include "token.h"
+#include "tokenlist.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <string>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    double nsPerToken(Clock::time_point start, Clock::time_point end, std::size_t tokens)
+    {
+        return std::chrono::duration<double, std::nano>(end - start).count() / tokens;
+    }
+
+    template<class Pattern>
+    void benchmark(const Token* begin, const Token* end, const char pattern[], Pattern compiled, int iterations)
+    {
+        std::size_t tokens = 0;
+        std::size_t runtimeMatches = 0;
+        std::size_t compiledMatches = 0;
+
+        const Clock::time_point start = Clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            for (const Token* tok = begin; tok != end; tok = tok->next()) {
+                if (Token::Match(tok, pattern))
+                    ++runtimeMatches;
+                ++tokens;
+            }
+        }
+        const Clock::time_point middle = Clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            for (const Token* tok = begin; tok != end; tok = tok->next()) {
+                if (Token::Match(tok, compiled))
+                    ++compiledMatches;
+            }
+        }
+        const Clock::time_point stop = Clock::now();
+
+        const double runtimeNs = nsPerToken(start, middle, tokens);
+        const double compiledNs = nsPerToken(middle, stop, tokens);
+        std::cout << std::left << std::setw(45) << pattern << std::right << std::fixed << std::setprecision(2)
+                  << " runtime: " << std::setw(6) << runtimeNs << " ns"
+                  << " compiled: " << std::setw(6) << compiledNs << " ns"
+                  << " speedup: " << std::setw(5) << (runtimeNs / compiledNs) << "x";
+        if (runtimeMatches != compiledMatches)
+            std::cout << " MISMATCH (" << runtimeMatches << " / " << compiledMatches << ")";
+        std::cout << std::endl;
+    }
+}
+
+#define BENCHMARK(pattern) benchmark(begin, end, pattern, MATCH_PATTERN(pattern), iterations)
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2) {
+        std::cout << "syntax: matchbench <file> [iterations] [tokens]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::ifstream fin(argv[1]);
+    if (!fin.is_open()) {
+        std::cout << "failed to open " << argv[1] << std::endl;
+        return EXIT_FAILURE;
+    }
+    const std::string code((std::istreambuf_iterator<char>(fin)), std::istreambuf_iterator<char>());
+    const int iterations = (argc > 2) ? std::atoi(argv[2]) : 1000;
+    // only use the first tokens so the matching and not the memory access is measured
+    const int maxTokens = (argc > 3) ? std::atoi(argv[3]) : 4096;
+
+    const Settings settings;
+    TokenList tokenlist(settings, Standards::Language::CPP);
+    tokenlist.appendFileIfNew(argv[1]);
+    if (!tokenlist.createTokensFromBuffer(code.data(), code.size())) {
+        std::cout << "failed to tokenize " << argv[1] << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const Token* const begin = tokenlist.front();
+    const Token* end = begin;
+    for (int i = 0; i < maxTokens && end; ++i)
+        end = end->next();
+
+    BENCHMARK("%name% (");
+    BENCHMARK("if|while|for (");
+    BENCHMARK("{|}|namespace|class|struct|union");
+    BENCHMARK("template < !!>");
+    BENCHMARK("[({]");
+    BENCHMARK("&&|?|%oror%");
+    BENCHMARK("%cop%|[|.");
+    BENCHMARK("%bool%|%num%|%str%|%char%|nullptr|NULL");
+    BENCHMARK(":: ~ %name% (");
+    BENCHMARK("using ::| %name% ::");
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,55 @@
+#!/usr/bin/env python3
+
+# Measure the peak memory usage of one or more cppcheck binaries on a set of files
+# Example usage:
+# python3 tools/measure-memory.py --cppcheck ~/cppcheck-old/cppcheck --cppcheck ./cppcheck test/cfg/*.c test/cfg/*.cpp
+#
+# Every file is checked separately so the peak resident set size reported for a file is
+# the one of the process which checked it. Only Linux and macOS are supported.
+
+import argparse
+import os
+import resource
+import subprocess
+import sys
+
+
+def measure(cppcheck, args, filename):
+    # ru_maxrss of RUSAGE_CHILDREN is the maximum of all waited for children so every
+    # measurement needs a fresh process
+    cmd = [sys.executable, __file__, '--child', cppcheck] + args + [filename]
+    out = subprocess.check_output(cmd)
+    return int(out)
+
+
+def run_child(cmd):
+    subprocess.call(cmd, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+    maxrss = resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss
+    # kilobytes on Linux, bytes on macOS
+    if sys.platform == 'darwin':
+        maxrss //= 1024
+    print(maxrss)
+
+
+if __name__ == "__main__":
+    if len(sys.argv) > 2 and sys.argv[1] == '--child':
+        run_child(sys.argv[2:])
+        sys.exit(0)
+
+    parser = argparse.ArgumentParser(description='Measure the peak memory usage of cppcheck binaries')
+    parser.add_argument('--cppcheck', action='append', required=True, help='Path to a cppcheck binary, can be given several times')
+    parser.add_argument('--args', default='-q --enable=all --inconclusive --check-level=exhaustive', help='Arguments passed to cppcheck')
+    parser.add_argument('files', nargs='+', help='Files to check')
+    args = parser.parse_args()
+
+    cppcheck_args = args.args.split()
+    totals = [0] * len(args.cppcheck)
+    print('file ' + ' '.join(args.cppcheck))
+    for filename in args.files:
+        results = []
+        for i, cppcheck in enumerate(args.cppcheck):
+            maxrss = measure(os.path.expanduser(cppcheck), cppcheck_args, filename)
+            totals[i] += maxrss
+            results.append(maxrss)
+        print(filename + ' ' + ' '.join('{}kB'.format(r) for r in results))
+    print('total ' + ' '.join('{}kB'.format(t) for t in totals))